@@ -0,0 +1,59 @@
+project "chip8_bench"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+	staticruntime "off"
+	location "%{OutputDirs.Solution}"
+
+	--- OUTPUT
+	targetdir "%{OutputDirs.Bin}%{cfg.buildcfg}/"
+	debugdir "%{OutputDirs.Bin}%{cfg.buildcfg}/"
+	objdir "%{OutputDirs.BinInt}%{prj.name}-%{cfg.buildcfg}"
+
+	--- INCLUDES DIRS
+	includedirs "%{IncludeDirs.chip8}"
+	externalincludedirs "%{IncludeDirs.chip8}"
+
+	--- SOURCE FILES
+	files {
+        "%{IncludeDirs.chip8_bench}**.h",	
+        "%{IncludeDirs.chip8_bench}**.cpp"
+    }
+
+	links "chip8"
+
+	--- LINUX
+	filter "system:linux"
+		--- LINUX SPECIFIC DEFINES
+		defines { "LINUX" }
+
+	--- WINDOWS
+	filter "system:windows"
+		flags "MultiProcessorCompile"
+
+		--- WINDOWS SPECIFIC DEFINES
+		defines { "WINDOWS" }
+
+	--- CONFIGURATION
+	filter "configurations:Debug"
+		runtime "Debug"
+		symbols "On"
+
+		--- DEFINES
+		defines { "DEBUG" }
+
+	filter "configurations:Release"
+		runtime "Release"
+		optimize "On"
+		symbols "On"
+
+		--- DEFINES
+		defines { "RELEASE" }
+
+	filter "configurations:Dist"
+		runtime "Release"
+		optimize "On"
+		symbols "Off"
+
+		--- DEFINES
+		defines { "DIST" }
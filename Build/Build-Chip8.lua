@@ -1,6 +1,7 @@
 project "chip8"
 	kind "StaticLib"
 	language "C++"
+	cppdialect "C++20"
 	staticruntime "off"
 	location "%{OutputDirs.Solution}"
 
@@ -13,15 +14,31 @@ project "chip8"
 	files {
 		"%{IncludeDirs.chip8}**.h",
 		"%{IncludeDirs.chip8}chip8.cpp",
+		"%{IncludeDirs.chip8}chip8_audio_manager.cpp",
 		"%{IncludeDirs.chip8}chip8_cmu.cpp",
 		"%{IncludeDirs.chip8}chip8_cpu_implementation.cpp",
 		"%{IncludeDirs.chip8}chip8_cpu_opcode_manager.cpp",
 		"%{IncludeDirs.chip8}chip8_cpu_option_manager.cpp",
+		"%{IncludeDirs.chip8}chip8_cpu_random_manager.cpp",
 		"%{IncludeDirs.chip8}chip8_cpu_timer_manager.cpp",
+		"%{IncludeDirs.chip8}chip8_event_trace.cpp",
+		"%{IncludeDirs.chip8}chip8_execution.cpp",
+		"%{IncludeDirs.chip8}chip8_input_queue.cpp",
+		"%{IncludeDirs.chip8}chip8_machine_arena.cpp",
+		"%{IncludeDirs.chip8}chip8_mapped_file.cpp",
+		"%{IncludeDirs.chip8}chip8_metrics.cpp",
+		"%{IncludeDirs.chip8}chip8_metrics_exporter.cpp",
 		"%{IncludeDirs.chip8}chip8_mmu.cpp",
+		"%{IncludeDirs.chip8}chip8_movie.cpp",
+		"%{IncludeDirs.chip8}chip8_pacer.cpp",
+		"%{IncludeDirs.chip8}chip8_profiler.cpp",
 		"%{IncludeDirs.chip8}chip8_rmu.cpp",
+		"%{IncludeDirs.chip8}chip8_rom_bundle.cpp",
+		"%{IncludeDirs.chip8}chip8_rom_library.cpp",
 		"%{IncludeDirs.chip8}chip8_smu.cpp",
-		"%{IncludeDirs.chip8}chip8_stack_mananger.cpp"
+		"%{IncludeDirs.chip8}chip8_stack_mananger.cpp",
+		"%{IncludeDirs.chip8}chip8_timer_service.cpp",
+		"%{IncludeDirs.chip8}chip8_trace.cpp"
 	}
 
 	--- LINUX
@@ -31,7 +48,6 @@ project "chip8"
 
 	--- WINDOWS
 	filter "system:windows"
-		cppdialect "C++20"
 		flags "MultiProcessorCompile"
 
 		--- WINDOWS SPECIFIC DEFINES
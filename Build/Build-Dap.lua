@@ -1,6 +1,7 @@
 project "chip8_dap"
 	kind "ConsoleApp"
 	language "C++"
+	cppdialect "C++20"
 	staticruntime "off"
 	location "%{OutputDirs.Solution}"
 
@@ -28,7 +29,6 @@ project "chip8_dap"
 
 	--- WINDOWS
 	filter "system:windows"
-		cppdialect "C++20"
 		flags "MultiProcessorCompile"
 
 		--- WINDOWS SPECIFIC DEFINES
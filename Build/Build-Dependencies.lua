@@ -17,3 +17,8 @@ IncludeDirs = { }
 --- EXAMPLES PROJECT
 IncludeDirs[ 'chip8' ] = '%{wks.location}src/'
 IncludeDirs[ 'chip8_dap' ] = '%{wks.location}dap/src/'
+IncludeDirs[ 'chip8_compare' ] = '%{wks.location}compare/src/'
+IncludeDirs[ 'chip8_conformance' ] = '%{wks.location}conformance/src/'
+IncludeDirs[ 'chip8_decoder' ] = '%{wks.location}decoder/src/'
+IncludeDirs[ 'chip8_packer' ] = '%{wks.location}packer/src/'
+IncludeDirs[ 'chip8_bench' ] = '%{wks.location}bench/src/'
@@ -1,6 +1,7 @@
 project "chip8_example"
 	kind "ConsoleApp"
 	language "C++"
+	cppdialect "C++20"
 	staticruntime "off"
 	location "%{OutputDirs.Solution}"
 
@@ -25,7 +26,6 @@ project "chip8_example"
 
 	--- WINDOWS
 	filter "system:windows"
-		cppdialect "C++20"
 		flags "MultiProcessorCompile"
 
 		--- WINDOWS SPECIFIC DEFINES
@@ -3,6 +3,12 @@ include 'Premake/CSExtensions.lua'
 include 'Premake/VSExtensions.lua'
 include 'Build-Dependencies.lua'
 
+--- OPTIONS
+newoption {
+    trigger = 'opcode-stats',
+    description = 'Count and time executed opcodes, see CHIP8_OPCODE_STATS'
+}
+
 --- PROJECT CONFIGURATION
 workspace 'Chip8'
     startproject 'chip8_example'
@@ -26,7 +32,23 @@ workspace 'Chip8'
             '/Zc:__cplusplus' 
         }
 
+    --- OPCODE STATISTICS
+    filter 'options:opcode-stats'
+        defines { 'CHIP8_OPCODE_STATS' }
+
+    filter { }
+
     --- PROJECTS
+    include 'Build-Bench.lua'
     include 'Build-Chip8.lua'
-    include 'Build-Dap.lua'
+    include 'Build-Compare.lua'
+    include 'Build-Conformance.lua'
+
+    -- chip8_dap builds against the vendored simdjson 4.0.6, simdjson.h sits next to simdjson.cpp.
+    if os.isfile( path.join( _SCRIPT_DIR, '../dap/src/thirdparty/simdjson.h' ) ) then
+        include 'Build-Dap.lua'
+    end
+
+    include 'Build-Decoder.lua'
     include 'Build-Example.lua'
+    include 'Build-Packer.lua'
@@ -0,0 +1,315 @@
+#include "chip8_bench.h"
+
+#if defined( DEBUG )
+#   define CHIP8_BENCH_CONFIGURATION "Debug"
+#elif defined( DIST )
+#   define CHIP8_BENCH_CONFIGURATION "Dist"
+#else
+#   define CHIP8_BENCH_CONFIGURATION "Release"
+#endif
+
+#if defined( WINDOWS )
+#   define CHIP8_BENCH_OS "Windows"
+#elif defined( __APPLE__ )
+#   define CHIP8_BENCH_OS "macOS"
+#else
+#   define CHIP8_BENCH_OS "Linux"
+#endif
+
+#ifndef WINDOWS
+#   include <unistd.h>
+#endif
+
+#if defined( _MSC_VER )
+#   define CHIP8_BENCH_STRINGIFY( VALUE ) #VALUE
+#   define CHIP8_BENCH_VERSION( VALUE ) CHIP8_BENCH_STRINGIFY( VALUE )
+#   define CHIP8_BENCH_COMPILER "MSVC " CHIP8_BENCH_VERSION( _MSC_VER )
+#elif defined( __clang__ )
+#   define CHIP8_BENCH_COMPILER __VERSION__
+#else
+#   define CHIP8_BENCH_COMPILER "GCC " __VERSION__
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_bench::chip8_bench( )
+    : workloads{ },
+    results{ },
+    filter{ },
+    output_path{ },
+    instruction_count{ 10000000 },
+    repeats{ 5 },
+    target_speed{ 700 }
+{
+    // Opcode families.
+    add( "alu", "8XYN", {
+        0x6001, 0x6103, 0x6207,
+        0x8014, 0x8125, 0x8231, 0x8302, 0x8016, 0x810E, 0x8213, 0x8320, 0x1006
+    } );
+
+    add( "branch", "3XNN/1NNN", {
+        0x6000, 0x7001, 0x30FF, 0x1002, 0x6000, 0x1002
+    } );
+
+    add( "call", "2NNN/00EE", {
+        0x2006, 0x2008, 0x1000, 0x00EE, 0x2006, 0x00EE
+    } );
+
+    add( "draw", "DXYN", {
+        0xA050, 0xD015, 0x7005, 0x7103, 0xD01F, 0x1002
+    } );
+
+    add( "memory", "FX55/FX65", {
+        0xA400, 0xFF55, 0xFF65, 0x1002
+    } );
+
+    // Game like mixes.
+    add( "game_loop", "mixed", {
+        0x00E0, 0x6A00, 0x6B00, 0x2014, 0xA050, 0xDAB5, 0xEA9E, 0x7A01,
+        0xF007, 0x1006, 0xC30F, 0x8B34, 0x7B01, 0x4B20, 0x6B00, 0x00EE
+    } );
+
+    add( "sprite_heavy", "mixed", {
+        0x00E0, 0xA050, 0x6000, 0x6100, 0xD015, 0x7008, 0xD015, 0x7108,
+        0xD015, 0x3040, 0x1008, 0x1000
+    } );
+
+    add( "bcd", "mixed", {
+        0x6500, 0xA400, 0xF533, 0xF265, 0x7501, 0x8204, 0x1002
+    } );
+}
+
+void chip8_bench::parse_option( chip8_string argument ) {
+    switch ( argument[ 1 ] ) {
+        case 'n' :
+        case 'N' :
+            instruction_count = std::max( std::strtoull( argument + 2, nullptr, 10 ), 1ULL );
+            break;
+
+        case 'o' :
+        case 'O' :
+            output_path = argument + 2;
+            break;
+
+        case 'r' :
+        case 'R' :
+            repeats = std::max( uint32_t( std::strtoul( argument + 2, nullptr, 10 ) ), uint32_t( 1 ) );
+            break;
+
+        case 't' :
+        case 'T' :
+            target_speed = std::max( uint32_t( std::strtoul( argument + 2, nullptr, 10 ) ), uint32_t( 60 ) );
+            break;
+
+        case 'w' :
+        case 'W' :
+            filter = argument + 2;
+            break;
+
+        default : break;
+    }
+}
+
+void chip8_bench::execute( ) {
+    for ( const auto& workload : workloads ) {
+        if ( !filter.empty( ) && filter != workload.name && filter != workload.family )
+            continue;
+
+        results.emplace_back( measure( workload ) );
+    }
+}
+
+bool chip8_bench::write( ) const {
+    auto* file = stdout;
+
+    if ( !output_path.empty( ) && !( file = std::fopen( output_path.c_str( ), "w" ) ) ) {
+        printf( "> Can't write results : %s\n", output_path.c_str( ) );
+
+        return false;
+    }
+
+    fprintf( file, "{\n  \"metadata\": {\n" );
+    fprintf( file, "    \"host\": \"%s\",\n", get_host( ).c_str( ) );
+    fprintf( file, "    \"cpu\": \"%s\",\n", get_cpu( ).c_str( ) );
+    fprintf( file, "    \"cores\": %u,\n", std::thread::hardware_concurrency( ) );
+    fprintf( file, "    \"os\": \"%s\",\n", CHIP8_BENCH_OS );
+    fprintf( file, "    \"timestamp\": \"%s\",\n", get_timestamp( ).c_str( ) );
+    fprintf( file, "    \"compiler\": \"%s\",\n", CHIP8_BENCH_COMPILER );
+    fprintf( file, "    \"configuration\": \"%s\",\n", CHIP8_BENCH_CONFIGURATION );
+    fprintf( file, "    \"instructions\": %" PRIu64 ",\n", instruction_count );
+    fprintf( file, "    \"repeats\": %u,\n", repeats );
+    fprintf( file, "    \"target_speed\": %u\n  },\n  \"workloads\": [\n", target_speed );
+
+    for ( auto result_id = size_t( 0 ); result_id < results.size( ); result_id++ ) {
+        const auto& result  = results[ result_id ];
+        const auto median   = get_median( result.samples );
+        const auto speed    = median > 0.0 ? 1e9 / median : 0.0;
+        const auto frames   = speed / ( target_speed / 60.0 );
+        const auto [ min_sample, max_sample ] = std::minmax_element( result.samples.begin( ), result.samples.end( ) );
+
+        fprintf( file, "    {\n      \"name\": \"%s\",\n", result.workload->name );
+        fprintf( file, "      \"family\": \"%s\",\n", result.workload->family );
+        fprintf( file, "      \"state\": %u,\n", result.state );
+        fprintf( file, "      \"ns_per_instruction\": %.4f,\n", median );
+        fprintf( file, "      \"ns_per_instruction_min\": %.4f,\n", *min_sample );
+        fprintf( file, "      \"ns_per_instruction_max\": %.4f,\n", *max_sample );
+        fprintf( file, "      \"instructions_per_second\": %.0f,\n", speed );
+        fprintf( file, "      \"frames_per_second\": %.1f,\n", frames );
+        fprintf( file, "      \"samples\": [" );
+
+        for ( auto sample_id = size_t( 0 ); sample_id < result.samples.size( ); sample_id++ )
+            fprintf( file, "%s%.4f", sample_id > 0 ? ", " : " ", result.samples[ sample_id ] );
+
+        fprintf( file, " ]\n    }%s\n", result_id + 1 < results.size( ) ? "," : "" );
+    }
+
+    fprintf( file, "  ]\n}\n" );
+
+    if ( file != stdout )
+        std::fclose( file );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_bench::add(
+    chip8_string name,
+    chip8_string family,
+    std::initializer_list<uint16_t> instructions
+) {
+    auto rom = std::vector<uint8_t>{ };
+
+    for ( const auto instruction : instructions ) {
+        rom.emplace_back( uint8_t( instruction >> 8 ) );
+        rom.emplace_back( uint8_t( instruction & 0xFF ) );
+    }
+
+    workloads.push_back( { name, family, std::move( rom ) } );
+}
+
+chip8_bench_result chip8_bench::measure( const chip8_bench_workload& workload ) const {
+    using clock_t = std::chrono::steady_clock;
+
+    auto result  = chip8_bench_result{ &workload, ecs_run, { } };
+    auto machine = std::make_unique<chip8>( false, false, true );
+
+    machine->set_option( ecc_option_limit, false );
+    machine->set_option( ecc_option_virtual, true );
+    machine->set_option( ecc_option_idle, false );
+    machine->get_rom( ).load( machine->get_mmu( ), workload.rom.data( ), uint16_t( workload.rom.size( ) ), workload.name );
+
+    // Warm up caches and branch predictors.
+    machine->set_instruction_limit( std::max( instruction_count / 10, uint64_t( 1 ) ) );
+    machine->reset( );
+    machine->resume( target_speed );
+    machine->set_instruction_limit( instruction_count );
+
+    for ( auto repeat = uint32_t( 0 ); repeat < repeats; repeat++ ) {
+        machine->reset( );
+
+        const auto start = clock_t::now( );
+
+        result.state = machine->resume( target_speed );
+
+        const auto elapsed = std::chrono::duration<double, std::nano>( clock_t::now( ) - start ).count( );
+        const auto count   = std::max( machine->get_hot_state( ).cycles, uint64_t( 1 ) );
+
+        result.samples.emplace_back( elapsed / double( count ) );
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+double chip8_bench::get_median( std::vector<double> samples ) {
+    if ( samples.empty( ) )
+        return 0.0;
+
+    const auto middle = samples.size( ) / 2;
+
+    std::nth_element( samples.begin( ), samples.begin( ) + middle, samples.end( ) );
+
+    return samples[ middle ];
+}
+
+std::string chip8_bench::get_host( ) {
+#ifdef WINDOWS
+    const auto* name = std::getenv( "COMPUTERNAME" );
+
+    return name ? name : "unknown";
+#else
+    auto name = std::array<char, 256>{ };
+
+    if ( gethostname( name.data( ), name.size( ) - 1 ) != 0 )
+        return "unknown";
+
+    return name.data( );
+#endif
+}
+
+std::string chip8_bench::get_cpu( ) {
+#ifdef WINDOWS
+    const auto* name = std::getenv( "PROCESSOR_IDENTIFIER" );
+
+    return name ? name : "unknown";
+#else
+    auto cpuinfo = std::ifstream{ "/proc/cpuinfo" };
+    auto line    = std::string{ };
+
+    while ( std::getline( cpuinfo, line ) ) {
+        if ( line.rfind( "model name", 0 ) != 0 )
+            continue;
+
+        const auto split = line.find( ':' );
+
+        if ( split != std::string::npos && split + 2 <= line.size( ) )
+            return line.substr( split + 2 );
+    }
+
+    return "unknown";
+#endif
+}
+
+std::string chip8_bench::get_timestamp( ) {
+    const auto now = std::time( nullptr );
+    auto text      = std::array<char, 32>{ };
+    auto time      = std::tm{ };
+
+#ifdef WINDOWS
+    gmtime_s( &time, &now );
+#else
+    gmtime_r( &now, &time );
+#endif
+
+    std::strftime( text.data( ), text.size( ), "%Y-%m-%dT%H:%M:%SZ", &time );
+
+    return text.data( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+int chip8_bench::run( int argc, char** argv ) {
+    auto bench = chip8_bench{ };
+
+    for ( auto arg_id = 1; arg_id < argc; arg_id++ ) {
+        const auto* argument = argv[ arg_id ];
+
+        if ( argument[ 0 ] == '-' )
+            bench.parse_option( argument );
+        else {
+            printf( "> Usage : chip8_bench [-nN] [-rN] [-tN] [-wName] [-oFile]\n" );
+
+            return -1;
+        }
+    }
+
+    bench.execute( );
+
+    return bench.write( ) ? 0 : -1;
+}
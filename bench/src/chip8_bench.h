@@ -0,0 +1,137 @@
+#pragma once
+
+#include "chip8.h"
+
+#include <ctime>
+
+/**
+ * Define a benchmark workload.
+ * @field name : Workload name.
+ * @field family : Stressed opcode family.
+ * @field rom : Generated ROM bytes.
+ **/
+struct chip8_bench_workload {
+    chip8_string name;
+    chip8_string family;
+    std::vector<uint8_t> rom;
+};
+
+/**
+ * Define a benchmark workload result.
+ * @field workload : Reference to measured workload.
+ * @field state : Execution state of the last repeat.
+ * @field samples : Nanoseconds per instruction of each repeat.
+ **/
+struct chip8_bench_result {
+    const chip8_bench_workload* workload;
+    echip8_states state;
+    std::vector<double> samples;
+};
+
+/**
+ * chip8_bench class
+ * @note Command line benchmark, run generated ROM stressing each
+ *       opcode family and a few game like mixes unthrottled, and
+ *       report throughput as JSON.
+ **/
+class chip8_bench final {
+
+private:
+    std::vector<chip8_bench_workload> workloads;
+    std::vector<chip8_bench_result> results;
+    std::string filter;
+    std::string output_path;
+    uint64_t instruction_count;
+    uint32_t repeats;
+    uint32_t target_speed;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_bench( );
+
+    /**
+     * parse_option method
+     * @note Parse benchmark option.
+     * @param argument : Target argument to parse.
+     **/
+    void parse_option( chip8_string argument );
+
+    /**
+     * execute method
+     * @note Measure every workload matching the filter.
+     **/
+    void execute( );
+
+    /**
+     * write function
+     * @note Write results as JSON to output file or stdout.
+     * @return True when results were written.
+     **/
+    bool write( ) const;
+
+private:
+    /**
+     * add method
+     * @note Add a workload from its instructions.
+     * @param name : Workload name.
+     * @param family : Stressed opcode family.
+     * @param instructions : Workload instructions, jump addresses 
+     *                       are relative to ROM start.
+     **/
+    void add(
+        chip8_string name,
+        chip8_string family,
+        std::initializer_list<uint16_t> instructions
+    );
+
+    /**
+     * measure function
+     * @note Run a workload for each repeat after a warm up run.
+     * @param workload : Target workload.
+     * @return Workload result.
+     **/
+    chip8_bench_result measure( const chip8_bench_workload& workload ) const;
+
+private:
+    /**
+     * get_median function
+     * @note Get median of samples.
+     * @param samples : Target samples.
+     * @return Median value.
+     **/
+    static double get_median( std::vector<double> samples );
+
+    /**
+     * get_host function
+     * @note Get machine host name.
+     * @return Host name, "unknown" when unavailable.
+     **/
+    static std::string get_host( );
+
+    /**
+     * get_cpu function
+     * @note Get processor model name.
+     * @return Processor model name, "unknown" when unavailable.
+     **/
+    static std::string get_cpu( );
+
+    /**
+     * get_timestamp function
+     * @note Get current UTC time.
+     * @return ISO 8601 UTC time like "2024-01-31T12:00:00Z".
+     **/
+    static std::string get_timestamp( );
+
+public:
+    /**
+     * run function
+     * @note Run the benchmark.
+     * @param argc : Target input argument count.
+     * @param argv : Target input argument value.
+     * @return Return execution state.
+     **/
+    static int run( int argc, char** argv );
+
+};
@@ -0,0 +1,5 @@
+#include "chip8_bench.h"
+
+int main( int argc, char** argv ) {
+    return chip8_bench::run( argc, argv );
+}
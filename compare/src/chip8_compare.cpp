@@ -0,0 +1,551 @@
+#include "chip8_compare.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_compare::chip8_compare( )
+    : baseline{ },
+    candidate{ },
+    store_path{ },
+    threshold{ 3.0 },
+    alpha{ 0.05 }
+{ }
+
+void chip8_compare::parse_option( chip8_string argument ) {
+    switch ( argument[ 1 ] ) {
+        case 'a' :
+        case 'A' :
+            alpha = std::clamp( std::strtod( argument + 2, nullptr ), 0.0, 1.0 );
+            break;
+
+        case 's' :
+        case 'S' :
+            store_path = argument + 2;
+            break;
+
+        case 't' :
+        case 'T' :
+            threshold = std::max( std::strtod( argument + 2, nullptr ), 0.0 );
+            break;
+
+        default : break;
+    }
+}
+
+bool chip8_compare::load( chip8_string baseline_path, chip8_string candidate_path ) {
+    auto error = std::error_code{ };
+    auto path  = std::string{ baseline_path };
+
+    // Store directory is created on first store.
+    if ( std::filesystem::is_directory( baseline_path, error ) || path == store_path ) {
+        path = get_latest( baseline_path );
+
+        // First stored run, nothing to compare against.
+        if ( path.empty( ) ) {
+            printf( "> No stored run : %s\n", baseline_path );
+
+            return read_run( candidate_path, candidate );
+        }
+    }
+
+    if ( !read_run( path, baseline ) ) {
+        printf( "> Can't read run : %s\n", path.c_str( ) );
+
+        return false;
+    }
+
+    if ( !read_run( candidate_path, candidate ) ) {
+        printf( "> Can't read run : %s\n", candidate_path );
+
+        return false;
+    }
+
+    return true;
+}
+
+uint32_t chip8_compare::execute( ) const {
+    auto regressions = uint32_t( 0 );
+
+    if ( baseline.workloads.empty( ) )
+        return regressions;
+
+    printf( "> Baseline  : %s\n> Candidate : %s\n", baseline.path.c_str( ), candidate.path.c_str( ) );
+
+    check_metadata( );
+
+    printf( "%-16s %12s %12s %9s %8s  %s\n", "workload", "base ns", "new ns", "delta", "p", "verdict" );
+
+    for ( const auto& workload : candidate.workloads ) {
+        auto by_name = [ &workload ]( const chip8_compare_workload& other ) -> bool {
+            return other.name == workload.name;
+        };
+
+        const auto base = std::find_if( baseline.workloads.begin( ), baseline.workloads.end( ), by_name );
+
+        if ( base == baseline.workloads.end( ) ) {
+            printf( "%-16s %12s %12.4f %9s %8s  new\n", workload.name.c_str( ), "-", get_median( workload.samples ), "-", "-" );
+
+            continue;
+        }
+
+        const auto base_median = get_median( base->samples );
+        const auto median      = get_median( workload.samples );
+        const auto delta       = base_median > 0.0 ? ( median - base_median ) / base_median * 100.0 : 0.0;
+        const auto p_value     = get_p_value( base->samples, workload.samples );
+        const auto is_signal   = p_value < alpha && std::abs( delta ) > threshold;
+
+        // Samples are time per instruction, a positive delta is slower.
+        auto* verdict = "same";
+
+        if ( is_signal && delta > 0.0 ) {
+            verdict      = "REGRESSION";
+            regressions += 1;
+        } else if ( is_signal )
+            verdict = "improvement";
+        else if ( std::abs( delta ) > threshold )
+            verdict = "noise";
+
+        printf( "%-16s %12.4f %12.4f %+8.2f%% %8.4f  %s\n", workload.name.c_str( ), base_median, median, delta, p_value, verdict );
+    }
+
+    for ( const auto& workload : baseline.workloads ) {
+        auto by_name = [ &workload ]( const chip8_compare_workload& other ) -> bool {
+            return other.name == workload.name;
+        };
+
+        if ( std::none_of( candidate.workloads.begin( ), candidate.workloads.end( ), by_name ) )
+            printf( "%-16s %12.4f %12s %9s %8s  removed\n", workload.name.c_str( ), get_median( workload.samples ), "-", "-", "-" );
+    }
+
+    printf( "> %u regression beyond %.1f%% at p < %.3f\n", regressions, threshold, alpha );
+
+    return regressions;
+}
+
+bool chip8_compare::store( ) const {
+    if ( store_path.empty( ) )
+        return true;
+
+    auto name = std::string{ };
+
+    for ( const auto key : { "timestamp", "host" } ) {
+        for ( const auto& [ meta_key, meta_value ] : candidate.metadata ) {
+            if ( meta_key == key )
+                name += ( name.empty( ) ? "" : "_" ) + meta_value;
+        }
+    }
+
+    if ( name.empty( ) )
+        name = std::filesystem::path( candidate.path ).stem( ).string( );
+
+    // Keep the name sortable and valid on every filesystem.
+    for ( auto& character : name ) {
+        if ( !std::isalnum( uint8_t( character ) ) && character != '-' && character != '_' )
+            character = '-';
+    }
+
+    auto error = std::error_code{ };
+
+    std::filesystem::create_directories( store_path, error );
+
+    const auto run_path = std::filesystem::path( store_path ) / ( name + ".json" );
+
+    std::filesystem::copy_file( candidate.path, run_path, std::filesystem::copy_options::overwrite_existing, error );
+
+    if ( error ) {
+        printf( "> Can't store run : %s\n", run_path.string( ).c_str( ) );
+
+        return false;
+    }
+
+    printf( "> Stored run : %s\n", run_path.string( ).c_str( ) );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_compare::check_metadata( ) const {
+    for ( const auto key : { "host", "cpu", "os", "compiler", "configuration", "instructions", "target_speed" } ) {
+        auto base_value = std::string{ "?" };
+        auto value      = std::string{ "?" };
+
+        for ( const auto& [ meta_key, meta_value ] : baseline.metadata ) {
+            if ( meta_key == key )
+                base_value = meta_value;
+        }
+
+        for ( const auto& [ meta_key, meta_value ] : candidate.metadata ) {
+            if ( meta_key == key )
+                value = meta_value;
+        }
+
+        if ( base_value != value )
+            printf( "> Warning, %s differ : %s -> %s\n", key, base_value.c_str( ), value.c_str( ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_compare::read_run( const std::string& run_path, chip8_compare_run& run ) {
+    auto file = std::ifstream{ run_path, std::ios::binary };
+
+    if ( !file )
+        return false;
+
+    const auto text = std::string{ std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>( ) };
+    auto offset     = size_t( 0 );
+
+    run.path = run_path;
+
+    auto read_workload = [ & ]( size_t& value_offset ) -> bool {
+        auto workload = chip8_compare_workload{ };
+
+        auto visitor = [ & ]( const std::string& key, size_t& key_offset ) -> bool {
+            if ( key == "name" )
+                return read_value( text, key_offset, workload.name );
+
+            if ( key != "samples" )
+                return false;
+
+            return read_array( text, key_offset, [ & ]( size_t& sample_offset ) -> bool {
+                auto sample = std::string{ };
+
+                if ( !read_value( text, sample_offset, sample ) )
+                    return false;
+
+                workload.samples.emplace_back( std::strtod( sample.c_str( ), nullptr ) );
+
+                return true;
+            } );
+        };
+
+        if ( !read_object( text, value_offset, visitor ) )
+            return false;
+
+        run.workloads.emplace_back( std::move( workload ) );
+
+        return true;
+    };
+
+    auto visitor = [ & ]( const std::string& key, size_t& key_offset ) -> bool {
+        if ( key == "workloads" )
+            return read_array( text, key_offset, read_workload );
+
+        if ( key != "metadata" )
+            return false;
+
+        return read_object( text, key_offset, [ & ]( const std::string& meta_key, size_t& meta_offset ) -> bool {
+            auto value = std::string{ };
+
+            if ( !read_value( text, meta_offset, value ) )
+                return false;
+
+            run.metadata.emplace_back( meta_key, value );
+
+            return true;
+        } );
+    };
+
+    return read_object( text, offset, visitor ) && !run.workloads.empty( );
+}
+
+bool chip8_compare::read_object(
+    std::string_view text,
+    size_t& offset,
+    const std::function<bool( const std::string&, size_t& )>& visitor
+) {
+    skip_space( text, offset );
+
+    if ( offset >= text.size( ) || text[ offset ] != '{' )
+        return false;
+
+    offset += 1;
+
+    skip_space( text, offset );
+
+    if ( offset < text.size( ) && text[ offset ] == '}' ) {
+        offset += 1;
+
+        return true;
+    }
+
+    while ( offset < text.size( ) ) {
+        auto key = std::string{ };
+
+        if ( !read_value( text, offset, key ) )
+            return false;
+
+        skip_space( text, offset );
+
+        if ( offset >= text.size( ) || text[ offset ] != ':' )
+            return false;
+
+        offset += 1;
+
+        const auto value_offset = offset;
+
+        // Visitor declined or failed, skip the value from its start.
+        if ( !visitor( key, offset ) ) {
+            auto ignored = std::string{ };
+
+            offset = value_offset;
+
+            if ( !read_value( text, offset, ignored ) )
+                return false;
+        }
+
+        skip_space( text, offset );
+
+        if ( offset < text.size( ) && text[ offset ] == ',' )
+            offset += 1;
+        else if ( offset < text.size( ) && text[ offset ] == '}' ) {
+            offset += 1;
+
+            return true;
+        } else
+            return false;
+    }
+
+    return false;
+}
+
+bool chip8_compare::read_array(
+    std::string_view text,
+    size_t& offset,
+    const std::function<bool( size_t& )>& visitor
+) {
+    skip_space( text, offset );
+
+    if ( offset >= text.size( ) || text[ offset ] != '[' )
+        return false;
+
+    offset += 1;
+
+    skip_space( text, offset );
+
+    if ( offset < text.size( ) && text[ offset ] == ']' ) {
+        offset += 1;
+
+        return true;
+    }
+
+    while ( offset < text.size( ) ) {
+        if ( !visitor( offset ) )
+            return false;
+
+        skip_space( text, offset );
+
+        if ( offset < text.size( ) && text[ offset ] == ',' )
+            offset += 1;
+        else if ( offset < text.size( ) && text[ offset ] == ']' ) {
+            offset += 1;
+
+            return true;
+        } else
+            return false;
+    }
+
+    return false;
+}
+
+bool chip8_compare::read_value( std::string_view text, size_t& offset, std::string& value ) {
+    skip_space( text, offset );
+
+    if ( offset >= text.size( ) )
+        return false;
+
+    const auto first = text[ offset ];
+
+    if ( first == '{' )
+        return read_object( text, offset, [ ]( const std::string&, size_t& ) -> bool { return false; } );
+
+    if ( first == '[' ) {
+        return read_array( text, offset, [ & ]( size_t& item_offset ) -> bool {
+            auto ignored = std::string{ };
+
+            return read_value( text, item_offset, ignored );
+        } );
+    }
+
+    value.clear( );
+
+    if ( first != '"' ) {
+        while ( offset < text.size( ) && std::strchr( ",}] \t\r\n", text[ offset ] ) == nullptr )
+            value += text[ offset++ ];
+
+        return !value.empty( );
+    }
+
+    // Escapes are kept as the escaped character, bench never emits \u.
+    for ( offset += 1; offset < text.size( ); offset++ ) {
+        if ( text[ offset ] == '"' ) {
+            offset += 1;
+
+            return true;
+        }
+
+        if ( text[ offset ] == '\\' && offset + 1 < text.size( ) )
+            offset += 1;
+
+        value += text[ offset ];
+    }
+
+    return false;
+}
+
+void chip8_compare::skip_space( std::string_view text, size_t& offset ) {
+    while ( offset < text.size( ) && ( text[ offset ] == ' ' || text[ offset ] == '\t' || text[ offset ] == '\r' || text[ offset ] == '\n' ) )
+        offset += 1;
+}
+
+std::string chip8_compare::get_latest( chip8_string store_directory ) {
+    auto error  = std::error_code{ };
+    auto latest = std::string{ };
+
+    // Stored names start with the run timestamp, latest sort last.
+    for ( const auto& item : std::filesystem::directory_iterator( store_directory, error ) ) {
+        if ( !item.is_regular_file( error ) || item.path( ).extension( ) != ".json" )
+            continue;
+
+        const auto path = item.path( ).string( );
+
+        if ( path > latest )
+            latest = path;
+    }
+
+    return latest;
+}
+
+double chip8_compare::get_median( std::vector<double> samples ) {
+    if ( samples.empty( ) )
+        return 0.0;
+
+    const auto middle = samples.size( ) / 2;
+
+    std::nth_element( samples.begin( ), samples.begin( ) + middle, samples.end( ) );
+
+    return samples[ middle ];
+}
+
+double chip8_compare::get_p_value( const std::vector<double>& first, const std::vector<double>& second ) {
+    const auto n1 = first.size( );
+    const auto n2 = second.size( );
+
+    if ( n1 == 0 || n2 == 0 )
+        return 1.0;
+
+    // Rank pooled samples, ties get their average rank.
+    auto pooled = std::vector<std::pair<double, uint32_t>>{ };
+
+    for ( const auto sample : first )
+        pooled.emplace_back( sample, 0 );
+
+    for ( const auto sample : second )
+        pooled.emplace_back( sample, 1 );
+
+    std::sort( pooled.begin( ), pooled.end( ) );
+
+    auto rank_sum = 0.0;
+    auto tie_term = 0.0;
+    auto has_ties = false;
+    auto pool_id  = size_t( 0 );
+
+    while ( pool_id < pooled.size( ) ) {
+        auto tie_end = pool_id + 1;
+
+        while ( tie_end < pooled.size( ) && pooled[ tie_end ].first == pooled[ pool_id ].first )
+            tie_end += 1;
+
+        const auto count = double( tie_end - pool_id );
+        const auto rank  = ( double( pool_id + 1 ) + double( tie_end ) ) / 2.0;
+
+        for ( auto tie_id = pool_id; tie_id < tie_end; tie_id++ ) {
+            if ( pooled[ tie_id ].second == 0 )
+                rank_sum += rank;
+        }
+
+        tie_term += count * count * count - count;
+        has_ties |= count > 1.0;
+        pool_id   = tie_end;
+    }
+
+    const auto u = rank_sum - double( n1 * ( n1 + 1 ) ) / 2.0;
+
+    if ( !has_ties && n1 * n2 <= ExactLimit ) {
+        // Count orderings per U value, f( n, m, u ) = f( n - 1, m, u - m ) + f( n, m - 1, u ).
+        const auto u_max = n1 * n2;
+
+        auto counts = std::vector<std::vector<double>>( n2 + 1, std::vector<double>( u_max + 1, 0.0 ) );
+
+        for ( auto m = size_t( 0 ); m <= n2; m++ )
+            counts[ m ][ 0 ] = 1.0;
+
+        for ( auto n = size_t( 1 ); n <= n1; n++ ) {
+            auto next = std::vector<std::vector<double>>( n2 + 1, std::vector<double>( u_max + 1, 0.0 ) );
+
+            next[ 0 ][ 0 ] = 1.0;
+
+            for ( auto m = size_t( 1 ); m <= n2; m++ ) {
+                for ( auto value = size_t( 0 ); value <= n * m; value++ ) {
+                    next[ m ][ value ] = next[ m - 1 ][ value ];
+
+                    if ( value >= m )
+                        next[ m ][ value ] += counts[ m ][ value - m ];
+                }
+            }
+
+            counts = std::move( next );
+        }
+
+        const auto& distribution = counts[ n2 ];
+        const auto total         = std::accumulate( distribution.begin( ), distribution.end( ), 0.0 );
+        const auto u_low         = size_t( std::min( u, double( u_max ) - u ) );
+        const auto tail          = std::accumulate( distribution.begin( ), distribution.begin( ) + u_low + 1, 0.0 );
+
+        return std::min( 1.0, 2.0 * tail / total );
+    }
+
+    const auto n        = double( n1 + n2 );
+    const auto mean     = double( n1 * n2 ) / 2.0;
+    const auto variance = double( n1 * n2 ) / 12.0 * ( ( n + 1.0 ) - tie_term / ( n * ( n - 1.0 ) ) );
+
+    if ( variance <= 0.0 )
+        return 1.0;
+
+    const auto z = std::max( std::abs( u - mean ) - 0.5, 0.0 ) / std::sqrt( variance );
+
+    return std::min( 1.0, std::erfc( z / std::sqrt( 2.0 ) ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+int chip8_compare::run( int argc, char** argv ) {
+    if ( argc < 3 ) {
+        printf( "> Usage : chip8_compare <baseline|store> <candidate> [-tPercent] [-aAlpha] [-sStore]\n" );
+
+        return -1;
+    }
+
+    auto compare = chip8_compare{ };
+
+    for ( auto arg_id = 3; arg_id < argc; arg_id++ ) {
+        const auto* argument = argv[ arg_id ];
+
+        if ( argument[ 0 ] == '-' )
+            compare.parse_option( argument );
+    }
+
+    if ( !compare.load( argv[ 1 ], argv[ 2 ] ) )
+        return -1;
+
+    const auto regressions = compare.execute( );
+
+    if ( !compare.store( ) )
+        return -1;
+
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "chip8.h"
+
+#include <numeric>
+#include <string_view>
+
+/**
+ * Define a benchmark workload read from a run.
+ * @field name : Workload name.
+ * @field samples : Nanoseconds per instruction of each repeat.
+ **/
+struct chip8_compare_workload {
+    std::string name;
+    std::vector<double> samples;
+};
+
+/**
+ * Define a benchmark run read from chip8_bench JSON.
+ * @field path : Run file path.
+ * @field metadata : Metadata key and value text.
+ * @field workloads : Measured workloads.
+ **/
+struct chip8_compare_run {
+    std::string path;
+    std::vector<std::pair<std::string, std::string>> metadata;
+    std::vector<chip8_compare_workload> workloads;
+};
+
+/**
+ * chip8_compare class
+ * @note Command line benchmark comparator, compare the samples of
+ *       each workload of two chip8_bench runs with a Mann-Whitney U
+ *       test and flag significant slowdowns beyond a threshold.
+ *       Runs can be stored in a directory, the latest stored run is
+ *       then used as baseline.
+ **/
+class chip8_compare final {
+
+public:
+    static constexpr uint32_t ExactLimit = 400;
+
+private:
+    chip8_compare_run baseline;
+    chip8_compare_run candidate;
+    std::string store_path;
+    double threshold;
+    double alpha;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_compare( );
+
+    /**
+     * parse_option method
+     * @note Parse comparator option.
+     * @param argument : Target argument to parse.
+     **/
+    void parse_option( chip8_string argument );
+
+    /**
+     * load function
+     * @note Load baseline and candidate runs, the baseline is left
+     *       empty when the store directory has no run yet.
+     * @param baseline_path : Baseline run or store directory.
+     * @param candidate_path : Candidate run.
+     * @return True when both runs were read.
+     **/
+    bool load( chip8_string baseline_path, chip8_string candidate_path );
+
+    /**
+     * execute function
+     * @note Compare candidate to baseline and print each workload.
+     * @return Regression count.
+     **/
+    uint32_t execute( ) const;
+
+    /**
+     * store function
+     * @note Copy candidate run to the store directory, named from
+     *       its timestamp and host.
+     * @return True when no store is set or the run was stored.
+     **/
+    bool store( ) const;
+
+private:
+    /**
+     * check_metadata method
+     * @note Warn about metadata that differ between runs.
+     **/
+    void check_metadata( ) const;
+
+private:
+    /**
+     * read_run function
+     * @note Read a chip8_bench JSON run.
+     * @param run_path : Target run path.
+     * @param run : Run to fill.
+     * @return True when the run was read.
+     **/
+    static bool read_run( const std::string& run_path, chip8_compare_run& run );
+
+    /**
+     * read_object function
+     * @note Read a JSON object, calling the visitor on each key with
+     *       the offset at its value. The visitor must consume the
+     *       value or return false to skip it.
+     * @param text : Target JSON text.
+     * @param offset : Current offset, moved after the object.
+     * @param visitor : Key visitor.
+     * @return True when the object is valid.
+     **/
+    static bool read_object(
+        std::string_view text,
+        size_t& offset,
+        const std::function<bool( const std::string&, size_t& )>& visitor
+    );
+
+    /**
+     * read_array function
+     * @note Read a JSON array, calling the visitor with the offset
+     *       at each value, the visitor must consume the value.
+     * @param text : Target JSON text.
+     * @param offset : Current offset, moved after the array.
+     * @param visitor : Value visitor.
+     * @return True when the array is valid.
+     **/
+    static bool read_array(
+        std::string_view text,
+        size_t& offset,
+        const std::function<bool( size_t& )>& visitor
+    );
+
+    /**
+     * read_value function
+     * @note Read a JSON scalar as text, skip objects and arrays.
+     * @param text : Target JSON text.
+     * @param offset : Current offset, moved after the value.
+     * @param value : Value text, unquoted for strings.
+     * @return True when the value is valid.
+     **/
+    static bool read_value( std::string_view text, size_t& offset, std::string& value );
+
+    /**
+     * skip_space method
+     * @note Move offset after JSON white spaces.
+     * @param text : Target JSON text.
+     * @param offset : Current offset.
+     **/
+    static void skip_space( std::string_view text, size_t& offset );
+
+private:
+    /**
+     * get_latest function
+     * @note Get the latest run of a store directory.
+     * @param store_directory : Target store directory.
+     * @return Latest run path, empty when none.
+     **/
+    static std::string get_latest( chip8_string store_directory );
+
+    /**
+     * get_median function
+     * @note Get median of samples.
+     * @param samples : Target samples.
+     * @return Median value.
+     **/
+    static double get_median( std::vector<double> samples );
+
+    /**
+     * get_p_value function
+     * @note Get two sided Mann-Whitney U test p-value, exact when
+     *       samples have no ties and n1 * n2 <= ExactLimit, normal
+     *       approximation with tie correction otherwise.
+     * @param first : First samples.
+     * @param second : Second samples.
+     * @return p-value, 1 when a side has no sample.
+     **/
+    static double get_p_value( const std::vector<double>& first, const std::vector<double>& second );
+
+public:
+    /**
+     * run function
+     * @note Run the comparator.
+     * @param argc : Target input argument count.
+     * @param argv : Target input argument value.
+     * @return 1 when a regression was found.
+     **/
+    static int run( int argc, char** argv );
+
+};
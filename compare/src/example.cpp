@@ -0,0 +1,5 @@
+#include "chip8_compare.h"
+
+int main( int argc, char** argv ) {
+    return chip8_compare::run( argc, argv );
+}
@@ -0,0 +1,542 @@
+#include "chip8_conformance.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_conformance::chip8_conformance( )
+    : roms{ },
+    tests{ },
+    results{ },
+    manifest_directory{ },
+    junit_path{ },
+    json_path{ },
+    golden_path{ },
+    thread_count{ std::max( std::thread::hardware_concurrency( ), 1u ) }
+{
+    // Nested calls, 00EE must return to the caller.
+    add( "return", {
+        0x6000, 0x200A, 0x200A, 0x6102, 0x0010,
+        0x7001, 0x2010, 0x00EE, 0x7010, 0x00EE
+    } );
+
+    // Opcodes with a high byte above 0x7F, fetch must not sign extend it.
+    add( "fetch_high", {
+        0x6005, 0xA123, 0xF01E, 0x6A80, 0x6BF0, 0x8AB4, 0x9AB0, 0x6E01,
+        0x6DEE, 0x0010
+    } );
+
+    // Carry and borrow flags, each VF is saved in V2 to V6.
+    add( "flags", {
+        0x60FF, 0x6101, 0x8014, 0x82F0, 0x6010, 0x6120, 0x8015, 0x83F0,
+        0x6005, 0x610A, 0x8017, 0x84F0, 0x6081, 0x8006, 0x85F0, 0x6081,
+        0x800E, 0x86F0, 0x0010
+    } );
+
+    // Shift quirk, legacy shifts copy VY first.
+    add( "shift", {
+        0x6081, 0x6103, 0x8016, 0x82F0, 0x8300, 0x6081, 0x610C, 0x801E,
+        0x84F0, 0x8500, 0x0010
+    } );
+
+    // Key bit order, EX9E skips on key 5 and EXA1 skips without key 7.
+    add( "keys", {
+        0x6505, 0xE59E, 0x6A01, 0x6607, 0xE6A1, 0x6B01, 0x0010
+    } );
+
+    // Endless recursion, V0 count calls up to the stack overflow.
+    add( "stack", {
+        0x7001, 0x2000
+    } );
+
+    // Sprite stored with FX55, drawn, erased with a collision, then drawn aside.
+    add( "draw", {
+        0x60F0, 0x6190, 0x6290, 0x63F0, 0xA300, 0xF355, 0x6405, 0x6503,
+        0xD454, 0x86F0, 0xD454, 0x87F0, 0x7408, 0xD454, 0x0010
+    } );
+
+    // Seeded random bytes.
+    add( "random", {
+        0xC0FF, 0xC1FF, 0xC20F, 0x0010
+    } );
+
+    // Delay timer wait loop, matched by idle loop skipping.
+    add( "delay_wait", {
+        0x6010, 0xF015, 0xF107, 0x3100, 0x1004, 0x7201, 0x0010
+    } );
+
+    // Jump to self, halt once timers reach zero.
+    add( "halt", {
+        0x6005, 0x1002
+    } );
+}
+
+void chip8_conformance::parse_option( chip8_string argument ) {
+    switch ( argument[ 1 ] ) {
+        case 'g' :
+        case 'G' :
+            golden_path = argument + 2;
+            break;
+
+        case 'j' :
+        case 'J' :
+            junit_path = argument + 2;
+            break;
+
+        case 'o' :
+        case 'O' :
+            json_path = argument + 2;
+            break;
+
+        case 't' :
+        case 'T' :
+            thread_count = std::max( uint32_t( std::strtoul( argument + 2, nullptr, 10 ) ), uint32_t( 1 ) );
+            break;
+
+        default : break;
+    }
+}
+
+bool chip8_conformance::load( chip8_string manifest_path ) {
+    auto manifest = std::ifstream{ manifest_path };
+
+    if ( !manifest ) {
+        printf( "> Can't read manifest : %s\n", manifest_path );
+
+        return false;
+    }
+
+    manifest_directory = std::filesystem::path( manifest_path ).parent_path( );
+
+    auto line = std::string{ };
+
+    while ( std::getline( manifest, line ) ) {
+        line = line.substr( 0, line.find( '#' ) );
+
+        auto stream = std::istringstream{ line };
+        auto test   = chip8_conformance_test{ { }, { }, { }, 10000000, 700, 0, 0, false, false, false };
+        auto token  = std::string{ };
+
+        if ( !( stream >> test.name >> test.rom_path ) )
+            continue;
+
+        while ( stream >> token ) {
+            const auto split = token.find( '=' );
+
+            if ( split == std::string::npos ) {
+                printf( "> Ignored manifest token : %s\n", token.c_str( ) );
+
+                continue;
+            }
+
+            const auto key   = token.substr( 0, split );
+            const auto value = token.substr( split + 1 );
+
+            if ( key == "limit" )
+                test.limit = std::strtoull( value.c_str( ), nullptr, 0 );
+            else if ( key == "speed" )
+                test.speed = std::max( uint32_t( std::strtoul( value.c_str( ), nullptr, 0 ) ), uint32_t( 60 ) );
+            else if ( key == "seed" )
+                test.seed = std::strtoull( value.c_str( ), nullptr, 0 );
+            else if ( key == "keys" )
+                test.keys = uint16_t( std::strtoul( value.c_str( ), nullptr, 16 ) );
+            else if ( key == "legacy" )
+                test.legacy = value != "0";
+            else if ( key == "stack" )
+                test.stack_limit = value != "0";
+            else if ( key == "idle" )
+                test.idle = value != "0";
+            else
+                test.expected.emplace_back( key, value );
+        }
+
+        tests.emplace_back( std::move( test ) );
+    }
+
+    return true;
+}
+
+void chip8_conformance::execute( ) {
+    results.resize( tests.size( ) );
+
+    auto next_test = std::atomic<size_t>{ 0 };
+    auto workers   = std::vector<std::thread>{ };
+
+    // Each worker own a whole machine per test, nothing is shared.
+    auto worker = [ & ]( ) -> void {
+        for ( auto test_id = next_test++; test_id < tests.size( ); test_id = next_test++ )
+            results[ test_id ] = run_test( tests[ test_id ] );
+    };
+
+    const auto worker_count = std::min( size_t( thread_count ), tests.size( ) );
+
+    for ( auto worker_id = size_t( 0 ); worker_id < worker_count; worker_id++ )
+        workers.emplace_back( worker );
+
+    for ( auto& thread : workers )
+        thread.join( );
+}
+
+uint32_t chip8_conformance::write( ) const {
+    auto failed   = uint32_t( 0 );
+    auto duration = 0.0;
+
+    for ( auto test_id = size_t( 0 ); test_id < tests.size( ); test_id++ ) {
+        const auto& result = results[ test_id ];
+
+        duration += result.duration;
+
+        if ( result.failures.empty( ) ) {
+            printf( "[ PASS ] %s (%.1f ms)\n", tests[ test_id ].name.c_str( ), result.duration );
+
+            continue;
+        }
+
+        failed += 1;
+
+        printf( "[ FAIL ] %s (%.1f ms)\n", tests[ test_id ].name.c_str( ), result.duration );
+
+        for ( const auto& failure : result.failures )
+            printf( "         %s\n", failure.c_str( ) );
+    }
+
+    printf( "> %zu tests, %u failed, %.1f ms on %u threads\n", tests.size( ), failed, duration, thread_count );
+
+    if ( !junit_path.empty( ) && !write_junit( ) )
+        printf( "> Can't write JUnit results : %s\n", junit_path.c_str( ) );
+
+    if ( !json_path.empty( ) && !write_json( ) )
+        printf( "> Can't write JSON results : %s\n", json_path.c_str( ) );
+
+    if ( !golden_path.empty( ) && !write_goldens( ) )
+        printf( "> Can't write goldens : %s\n", golden_path.c_str( ) );
+
+    return failed;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_conformance::add( chip8_string name, std::initializer_list<uint16_t> instructions ) {
+    auto rom = std::vector<uint8_t>{ };
+
+    for ( const auto instruction : instructions ) {
+        rom.emplace_back( uint8_t( instruction >> 8 ) );
+        rom.emplace_back( uint8_t( instruction & 0xFF ) );
+    }
+
+    roms.push_back( { name, std::move( rom ) } );
+}
+
+const chip8_conformance_rom* chip8_conformance::find_rom( const std::string& name ) const {
+    for ( const auto& rom : roms ) {
+        if ( name == rom.name )
+            return &rom;
+    }
+
+    return nullptr;
+}
+
+chip8_conformance_result chip8_conformance::run_test( const chip8_conformance_test& test ) const {
+    using clock_t = std::chrono::steady_clock;
+
+    const auto start        = clock_t::now( );
+    const auto is_synthetic = test.rom_path.starts_with( '@' );
+    const auto path         = is_synthetic ? test.rom_path : ( manifest_directory / test.rom_path ).string( );
+
+    auto result  = chip8_conformance_result{ ecs_iir, 0, 0, { }, 0, 0.0, { } };
+    auto machine = std::make_unique<chip8>( false, false, true );
+
+    // Deterministic run, timers follow instruction count.
+    machine->set_option( ecc_option_limit, false );
+    machine->set_option( ecc_option_virtual, true );
+    machine->set_option( ecc_option_idle, test.idle );
+    machine->set_option( ecc_option_legacy, test.legacy );
+    // Stack option set means an unlimited call stack.
+    machine->set_option( ecc_option_stack, !test.stack_limit );
+    machine->set_random_seed( test.seed );
+    machine->set_instruction_limit( test.limit );
+
+    // Key waits stay pending instead of reading stdin, the run end at limit.
+    machine->override_key_callback( chip8_cpu_implementation::exec_get_key_latch );
+
+    auto is_loaded = false;
+
+    if ( is_synthetic ) {
+        const auto* rom = find_rom( test.rom_path.substr( 1 ) );
+
+        is_loaded = rom && machine->get_rom( ).load( machine->get_mmu( ), rom->rom.data( ), uint16_t( rom->rom.size( ) ), rom->name );
+    } else
+        is_loaded = machine->get_rom( ).load( machine->get_mmu( ), path.c_str( ) );
+
+    if ( is_loaded ) {
+        const auto& hot = machine->get_hot_state( );
+
+        machine->reset( );
+
+        for ( auto key_id = uint8_t( 0 ); key_id < 16; key_id++ ) {
+            if ( test.keys & ( 1 << key_id ) )
+                machine->press_key( echip8_input_keys( key_id ) );
+        }
+
+        result.state       = machine->resume( test.speed );
+        result.exit_code   = machine->get_exit_code( );
+        result.screen_hash = machine->get_screen_hash( );
+        result.registers   = hot.V;
+        result.I           = hot.I;
+    } else
+        result.failures.emplace_back( "can't load ROM : " + path );
+
+    result.duration = std::chrono::duration<double, std::milli>( clock_t::now( ) - start ).count( );
+
+    if ( result.failures.empty( ) )
+        check( test, result );
+
+    return result;
+}
+
+void chip8_conformance::check( const chip8_conformance_test& test, chip8_conformance_result& result ) const {
+    auto text = std::array<char, 128>{ };
+
+    auto fail = [ & ]( chip8_string key, chip8_string expected, chip8_string actual ) -> void {
+        snprintf( text.data( ), text.size( ), "%s : expected %s, got %s", key, expected, actual );
+
+        result.failures.emplace_back( text.data( ) );
+    };
+
+    auto format = [ & ]( chip8_string pattern, const uint64_t value ) -> std::string {
+        snprintf( text.data( ), text.size( ), pattern, value );
+
+        return text.data( );
+    };
+
+    for ( const auto& [ key, value ] : test.expected ) {
+        if ( key == "state" ) {
+            const auto* actual = chip8_metrics::get_state_name( result.state );
+
+            if ( value != actual )
+                fail( "state", value.c_str( ), actual );
+        } else if ( key == "exit" ) {
+            if ( std::strtoul( value.c_str( ), nullptr, 0 ) != result.exit_code )
+                fail( "exit", value.c_str( ), format( "%" PRIu64, result.exit_code ).c_str( ) );
+        } else if ( key == "screen" ) {
+            if ( std::strtoull( value.c_str( ), nullptr, 16 ) != result.screen_hash )
+                fail( "screen", value.c_str( ), format( "%016" PRIx64, result.screen_hash ).c_str( ) );
+        } else if ( key == "i" ) {
+            if ( std::strtoul( value.c_str( ), nullptr, 16 ) != result.I )
+                fail( "i", value.c_str( ), format( "%03" PRIx64, result.I ).c_str( ) );
+        } else if ( key == "v" ) {
+            const auto actual = get_registers( result.registers );
+
+            if ( value != actual )
+                fail( "v", value.c_str( ), actual.c_str( ) );
+        } else if ( key.size( ) == 2 && ( key[ 0 ] == 'v' || key[ 0 ] == 'V' ) && std::isxdigit( key[ 1 ] ) ) {
+            const auto register_id = std::stoul( key.substr( 1 ), nullptr, 16 );
+            const auto actual      = result.registers[ register_id ];
+
+            if ( std::strtoul( value.c_str( ), nullptr, 16 ) != actual )
+                fail( key.c_str( ), value.c_str( ), format( "%02" PRIx64, actual ).c_str( ) );
+        } else
+            fail( key.c_str( ), value.c_str( ), "unknown golden" );
+    }
+}
+
+bool chip8_conformance::write_junit( ) const {
+    auto* file = std::fopen( junit_path.c_str( ), "w" );
+
+    if ( !file )
+        return false;
+
+    auto failed   = size_t( 0 );
+    auto duration = 0.0;
+
+    for ( const auto& result : results ) {
+        failed   += result.failures.empty( ) ? 0 : 1;
+        duration += result.duration;
+    }
+
+    fprintf( file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" );
+    fprintf( file, "<testsuite name=\"chip8_conformance\" tests=\"%zu\" failures=\"%zu\" time=\"%.3f\">\n", tests.size( ), failed, duration / 1000.0 );
+
+    // Names, paths and failures come from the manifest, escape them all.
+    for ( auto test_id = size_t( 0 ); test_id < tests.size( ); test_id++ ) {
+        const auto& test   = tests[ test_id ];
+        const auto& result = results[ test_id ];
+
+        fprintf( file, "  <testcase classname=\"chip8\" name=\"%s\" time=\"%.3f\"", escape_xml( test.name ).c_str( ), result.duration / 1000.0 );
+
+        if ( result.failures.empty( ) ) {
+            fprintf( file, "/>\n" );
+
+            continue;
+        }
+
+        fprintf( file, ">\n    <failure message=\"%s\">", escape_xml( result.failures.front( ) ).c_str( ) );
+
+        for ( const auto& failure : result.failures )
+            fprintf( file, "%s\n", escape_xml( failure ).c_str( ) );
+
+        fprintf( file, "</failure>\n  </testcase>\n" );
+    }
+
+    fprintf( file, "</testsuite>\n" );
+
+    return std::fclose( file ) == 0;
+}
+
+bool chip8_conformance::write_json( ) const {
+    auto* file = std::fopen( json_path.c_str( ), "w" );
+
+    if ( !file )
+        return false;
+
+    fprintf( file, "{\n  \"tests\": [\n" );
+
+    for ( auto test_id = size_t( 0 ); test_id < tests.size( ); test_id++ ) {
+        const auto& test   = tests[ test_id ];
+        const auto& result = results[ test_id ];
+
+        fprintf( file, "    {\n      \"name\": \"%s\",\n", escape_json( test.name ).c_str( ) );
+        fprintf( file, "      \"rom\": \"%s\",\n", escape_json( test.rom_path ).c_str( ) );
+        fprintf( file, "      \"passed\": %s,\n", result.failures.empty( ) ? "true" : "false" );
+        fprintf( file, "      \"state\": \"%s\",\n", chip8_metrics::get_state_name( result.state ) );
+        fprintf( file, "      \"exit\": %u,\n", result.exit_code );
+        fprintf( file, "      \"screen\": \"%016" PRIx64 "\",\n", result.screen_hash );
+        fprintf( file, "      \"v\": \"%s\",\n", get_registers( result.registers ).c_str( ) );
+        fprintf( file, "      \"i\": \"%03x\",\n", result.I );
+        fprintf( file, "      \"duration_ms\": %.3f,\n", result.duration );
+        fprintf( file, "      \"failures\": [" );
+
+        for ( auto failure_id = size_t( 0 ); failure_id < result.failures.size( ); failure_id++ )
+            fprintf( file, "%s\"%s\"", failure_id > 0 ? ", " : " ", escape_json( result.failures[ failure_id ] ).c_str( ) );
+
+        fprintf( file, " ]\n    }%s\n", test_id + 1 < tests.size( ) ? "," : "" );
+    }
+
+    fprintf( file, "  ]\n}\n" );
+
+    return std::fclose( file ) == 0;
+}
+
+bool chip8_conformance::write_goldens( ) const {
+    auto* file = std::fopen( golden_path.c_str( ), "w" );
+
+    if ( !file )
+        return false;
+
+    fprintf( file, "# name rom [limit=N] [speed=N] [seed=N] [keys=HEX] [legacy=0|1] [stack=0|1] [idle=0|1] goldens...\n" );
+
+    for ( auto test_id = size_t( 0 ); test_id < tests.size( ); test_id++ ) {
+        const auto& test   = tests[ test_id ];
+        const auto& result = results[ test_id ];
+
+        fprintf( file, "%s %s limit=%" PRIu64 " speed=%u seed=%" PRIu64, test.name.c_str( ), test.rom_path.c_str( ), test.limit, test.speed, test.seed );
+        fprintf( file, " keys=%04x legacy=%u stack=%u idle=%u", test.keys, test.legacy ? 1 : 0, test.stack_limit ? 1 : 0, test.idle ? 1 : 0 );
+
+        // Failed loads keep their previous goldens.
+        if ( result.state == ecs_iir ) {
+            for ( const auto& [ key, value ] : test.expected )
+                fprintf( file, " %s=%s", key.c_str( ), value.c_str( ) );
+
+            fprintf( file, "\n" );
+
+            continue;
+        }
+
+        fprintf( file, " state=%s", chip8_metrics::get_state_name( result.state ) );
+
+        if ( result.state == ecs_epv )
+            fprintf( file, " exit=%u", result.exit_code );
+
+        fprintf( file, " screen=%016" PRIx64 " v=%s i=%03x\n", result.screen_hash, get_registers( result.registers ).c_str( ), result.I );
+    }
+
+    return std::fclose( file ) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::string chip8_conformance::get_registers( const std::array<uint8_t, 16>& registers ) {
+    auto text = std::array<char, 33>{ };
+
+    for ( auto register_id = size_t( 0 ); register_id < registers.size( ); register_id++ )
+        snprintf( text.data( ) + register_id * 2, 3, "%02x", registers[ register_id ] );
+
+    return text.data( );
+}
+
+std::string chip8_conformance::escape_xml( const std::string& text ) {
+    auto escaped = std::string{ };
+
+    for ( const auto character : text ) {
+        switch ( character ) {
+            case '&'  : escaped += "&amp;";  break;
+            case '<'  : escaped += "&lt;";   break;
+            case '>'  : escaped += "&gt;";   break;
+            case '"'  : escaped += "&quot;"; break;
+            case '\'' : escaped += "&apos;"; break;
+            case '\t' :
+            case '\n' :
+            case '\r' : escaped += character; break;
+
+            default :
+                escaped += uint8_t( character ) < 0x20 ? ' ' : character;
+                break;
+        }
+    }
+
+    return escaped;
+}
+
+std::string chip8_conformance::escape_json( const std::string& text ) {
+    auto escaped = std::string{ };
+    auto buffer  = std::array<char, 8>{ };
+
+    for ( const auto character : text ) {
+        switch ( character ) {
+            case '"'  : escaped += "\\\""; break;
+            case '\\' : escaped += "\\\\"; break;
+            case '\n' : escaped += "\\n";  break;
+            case '\r' : escaped += "\\r";  break;
+            case '\t' : escaped += "\\t";  break;
+
+            default :
+                if ( uint8_t( character ) < 0x20 ) {
+                    snprintf( buffer.data( ), buffer.size( ), "\\u%04x", uint8_t( character ) );
+
+                    escaped += buffer.data( );
+                } else
+                    escaped += character;
+                break;
+        }
+    }
+
+    return escaped;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+int chip8_conformance::run( int argc, char** argv ) {
+    if ( argc < 2 ) {
+        printf( "> Usage : chip8_conformance <manifest> [-tN] [-jJUnit.xml] [-oResults.json] [-gGoldens.txt]\n" );
+
+        return -1;
+    }
+
+    auto conformance = chip8_conformance{ };
+
+    for ( auto arg_id = 2; arg_id < argc; arg_id++ ) {
+        const auto* argument = argv[ arg_id ];
+
+        if ( argument[ 0 ] == '-' )
+            conformance.parse_option( argument );
+    }
+
+    if ( !conformance.load( argv[ 1 ] ) )
+        return -1;
+
+    conformance.execute( );
+
+    return conformance.write( ) > 0 ? 1 : 0;
+}
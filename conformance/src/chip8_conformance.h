@@ -0,0 +1,209 @@
+#pragma once
+
+#include "chip8.h"
+
+#include <sstream>
+
+/**
+ * Define a built-in synthetic test ROM.
+ * @field name : ROM name, "@name" in a manifest.
+ * @field rom : Generated ROM bytes.
+ **/
+struct chip8_conformance_rom {
+    chip8_string name;
+    std::vector<uint8_t> rom;
+};
+
+/**
+ * Define a conformance test from the manifest.
+ * @field name : Test name.
+ * @field rom_path : ROM path, relative to the manifest directory,
+ *                   or "@name" for a built-in synthetic ROM.
+ * @field expected : Golden "key=value" pairs, state, exit, screen,
+ *                   i, v for the 16 registers or v0 to vf.
+ * @field limit : Instruction budget.
+ * @field speed : Instruction per second, paces virtual timers.
+ * @field seed : Random generator seed.
+ * @field keys : Keys held from the start, bit N for key N.
+ * @field legacy : True to use legacy shift quirk.
+ * @field stack_limit : True to limit call stack to 16 calls.
+ * @field idle : True to skip idle loops.
+ **/
+struct chip8_conformance_test {
+    std::string name;
+    std::string rom_path;
+    std::vector<std::pair<std::string, std::string>> expected;
+    uint64_t limit;
+    uint32_t speed;
+    uint64_t seed;
+    uint16_t keys;
+    bool legacy;
+    bool stack_limit;
+    bool idle;
+};
+
+/**
+ * Define a conformance test result.
+ * @field state : Final execution state.
+ * @field exit_code : Exit code for ecs_epv.
+ * @field screen_hash : Final screen buffer hash.
+ * @field registers : Final v0 to vf.
+ * @field I : Final index register.
+ * @field duration : Test wall time in milliseconds.
+ * @field failures : Golden mismatch descriptions, empty on pass.
+ **/
+struct chip8_conformance_result {
+    echip8_states state;
+    uint8_t exit_code;
+    uint64_t screen_hash;
+    std::array<uint8_t, 16> registers;
+    uint16_t I;
+    double duration;
+    std::vector<std::string> failures;
+};
+
+/**
+ * chip8_conformance class
+ * @note Command line conformance harness, run every manifest test
+ *       in parallel with virtual timers and a fixed seed, then
+ *       compare final state, screen hash and registers to goldens.
+ **/
+class chip8_conformance final {
+
+private:
+    std::vector<chip8_conformance_rom> roms;
+    std::vector<chip8_conformance_test> tests;
+    std::vector<chip8_conformance_result> results;
+    std::filesystem::path manifest_directory;
+    std::string junit_path;
+    std::string json_path;
+    std::string golden_path;
+    uint32_t thread_count;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_conformance( );
+
+    /**
+     * parse_option method
+     * @note Parse harness option.
+     * @param argument : Target argument to parse.
+     **/
+    void parse_option( chip8_string argument );
+
+    /**
+     * load function
+     * @note Load a manifest, one "name rom key=value..." test per
+     *       line, '#' start a comment.
+     * @param manifest_path : Target manifest path.
+     * @return True when the manifest was read.
+     **/
+    bool load( chip8_string manifest_path );
+
+    /**
+     * execute method
+     * @note Run every test across worker threads.
+     **/
+    void execute( );
+
+    /**
+     * write function
+     * @note Print summary and write JUnit, JSON and golden outputs.
+     * @return Failed test count.
+     **/
+    uint32_t write( ) const;
+
+private:
+    /**
+     * add method
+     * @note Add a synthetic ROM from its instructions.
+     * @param name : ROM name.
+     * @param instructions : ROM instructions, jumps target ROM
+     *                       offsets.
+     **/
+    void add( chip8_string name, std::initializer_list<uint16_t> instructions );
+
+    /**
+     * find_rom function
+     * @note Find a synthetic ROM by name.
+     * @param name : Target ROM name, without '@'.
+     * @return Pointer to the ROM, nullptr when unknown.
+     **/
+    const chip8_conformance_rom* find_rom( const std::string& name ) const;
+
+    /**
+     * run_test function
+     * @note Run a single test on its own machine.
+     * @param test : Target test.
+     * @return Test result.
+     **/
+    chip8_conformance_result run_test( const chip8_conformance_test& test ) const;
+
+    /**
+     * check method
+     * @note Compare a result to the test goldens.
+     * @param test : Target test.
+     * @param result : Target result, failures are appended.
+     **/
+    void check( const chip8_conformance_test& test, chip8_conformance_result& result ) const;
+
+    /**
+     * write_junit function
+     * @note Write results as JUnit XML.
+     * @return True when the file was written.
+     **/
+    bool write_junit( ) const;
+
+    /**
+     * write_json function
+     * @note Write results as JSON.
+     * @return True when the file was written.
+     **/
+    bool write_json( ) const;
+
+    /**
+     * write_goldens function
+     * @note Write the manifest back with goldens from results.
+     * @return True when the file was written.
+     **/
+    bool write_goldens( ) const;
+
+private:
+    /**
+     * get_registers function
+     * @note Get registers as 32 hexadecimal digits.
+     * @param registers : Target registers.
+     * @return Register string.
+     **/
+    static std::string get_registers( const std::array<uint8_t, 16>& registers );
+
+    /**
+     * escape_xml function
+     * @note Escape text for XML attributes and content, control
+     *       characters XML can't hold become spaces.
+     * @param text : Target text.
+     * @return Escaped text.
+     **/
+    static std::string escape_xml( const std::string& text );
+
+    /**
+     * escape_json function
+     * @note Escape text for a JSON string.
+     * @param text : Target text.
+     * @return Escaped text.
+     **/
+    static std::string escape_json( const std::string& text );
+
+public:
+    /**
+     * run function
+     * @note Run the conformance harness.
+     * @param argc : Target input argument count.
+     * @param argv : Target input argument value.
+     * @return 0 when every test passed.
+     **/
+    static int run( int argc, char** argv );
+
+};
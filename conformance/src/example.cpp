@@ -0,0 +1,5 @@
+#include "chip8_conformance.h"
+
+int main( int argc, char** argv ) {
+    return chip8_conformance::run( argc, argv );
+}
@@ -1,35 +1,952 @@
 #include "chip8_dap.h"
-#include "thirdparty/simdjson.h"
-
-#include <string>
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 chip8_dap::chip8_dap( )
+    : requests{ },
+    events{ },
+    reader{ },
+    writer{ events },
+    request{ },
+    parser{ },
+    document{ },
+    breakpoints{ },
+    history{ },
+    disassembly{ },
+    program{ },
+    speed{ 700 },
+    is_launched{ false },
+    is_running{ false },
+    stop_on_entry{ false },
+    stop_pc{ NoStop },
+    stop_depth{ 0 }
 { }
 
 void chip8_dap::send_response( const echip8_dap_command& command ) {
+    writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+    writer.send( );
 }
 
 bool chip8_dap::execute_command(
     const echip8_dap_command& command,
     chip8& chip8_instance
 ) {
-    return false;
+    switch ( command.type ) {
+        case ecd_command_initialize :
+            writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+            writer.begin_object( "body" );
+            writer.add_bool( "supportsConfigurationDoneRequest", true );
+            writer.add_bool( "supportsConditionalBreakpoints", true );
+            writer.add_bool( "supportsHitConditionalBreakpoints", true );
+            writer.add_bool( "supportsLogPoints", true );
+            writer.add_bool( "supportsStepBack", true );
+            writer.add_bool( "supportsDisassembleRequest", true );
+            writer.add_bool( "supportsReadMemoryRequest", true );
+            writer.add_bool( "supportsWriteMemoryRequest", true );
+            writer.end_object( );
+            writer.send( );
+
+            writer.begin_event( "initialized" );
+            writer.send( );
+            break;
+
+        case ecd_command_launch :
+            if ( !launch( chip8_instance ) ) {
+                send_error( command, "Can't load program." );
+
+                break;
+            }
+
+            send_response( command );
+            break;
+
+        case ecd_command_configuration_done :
+            send_response( command );
+
+            if ( !is_launched )
+                break;
+
+            if ( stop_on_entry ) {
+                send_stopped( chip8_instance, "entry" );
+
+                break;
+            }
+
+            is_running = true;
+
+            // The first instruction is never reached by resume.
+            if ( chip8_instance.get_breakpoint( chip8_instance.get_hot_state( ).PC ) )
+                check_breakpoint( chip8_instance );
+            break;
+
+        case ecd_command_set_breakpoints : set_breakpoints( command, chip8_instance ); break;
+
+        case ecd_command_continue :
+            writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+            writer.begin_object( "body" );
+            writer.add_bool( "allThreadsContinued", true );
+            writer.end_object( );
+            writer.send( );
+
+            set_stop( chip8_instance, NoStop, 0 );
+
+            is_running = is_launched;
+            break;
+
+        case ecd_command_next :
+        case ecd_command_step_in :
+            send_response( command );
+
+            step( chip8_instance, command.type == ecd_command_next );
+            break;
+
+        case ecd_command_step_back :
+        case ecd_command_reverse_continue :
+            send_response( command );
+
+            reverse( chip8_instance, command.type == ecd_command_reverse_continue );
+            break;
+
+        case ecd_command_pause :
+            send_response( command );
+
+            if ( is_running )
+                send_stopped( chip8_instance, "pause" );
+            break;
+
+        case ecd_command_threads :
+            writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+            writer.begin_object( "body" );
+            writer.begin_array( "threads" );
+            writer.begin_object( nullptr );
+            writer.add_number( "id", ThreadId );
+            writer.add_string( "name", "chip8" );
+            writer.end_object( );
+            writer.end_array( );
+            writer.end_object( );
+            writer.send( );
+            break;
+
+        case ecd_command_stack_trace : send_stack_trace( command, chip8_instance ); break;
+
+        case ecd_command_scopes :
+            writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+            writer.begin_object( "body" );
+            writer.begin_array( "scopes" );
+            writer.begin_object( nullptr );
+            writer.add_string( "name", "Registers" );
+            writer.add_string( "presentationHint", "registers" );
+            writer.add_number( "variablesReference", RegistersScope );
+            writer.add_bool( "expensive", false );
+            writer.end_object( );
+            writer.end_array( );
+            writer.end_object( );
+            writer.send( );
+            break;
+
+        case ecd_command_variables    : send_variables( command, chip8_instance ); break;
+        case ecd_command_disassemble  : send_disassembly( command, chip8_instance ); break;
+        case ecd_command_read_memory  : send_memory( command, chip8_instance ); break;
+        case ecd_command_write_memory : write_memory( command, chip8_instance ); break;
+
+        case ecd_command_disconnect :
+            send_response( command );
+
+            return false;
+
+        case ecd_command_quit : return false;
+
+        default : send_error( command, "Unsupported request." ); break;
+    }
+
+    return true;
+}
+
+void chip8_dap::execute_slice( chip8& chip8_instance ) {
+    // Full speed up to the slice end or the next snapshot, breakpoints
+    // are tested by the machine itself against its address bitmap.
+    const auto slice_end = chip8_instance.get_hot_state( ).cycles + SliceSize;
+
+    chip8_instance.set_instruction_limit( std::min( slice_end, history.get_next_cycle( ) ) );
+
+    const auto state = chip8_instance.resume( speed );
+
+    history.record( chip8_instance );
+
+    if ( state == ecs_brk )
+        check_breakpoint( chip8_instance );
+    else if ( state != ecs_ilr )
+        send_terminated( chip8_instance, state );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_dap::launch( chip8& chip8_instance ) {
+    auto arguments   = simdjson::ondemand::object{ };
+    auto path        = std::string_view{ };
+    auto is_legacy   = false;
+    auto is_limited  = true;
+    auto ips         = uint64_t( 700 );
+    auto seed        = uint64_t( 0 );
+    auto is_on_entry = false;
+
+    if ( document[ "arguments" ].get_object( ).get( arguments ) )
+        return false;
+
+    // Single pass over arguments, missing members keep their default.
+    for ( auto field : arguments ) {
+        auto key   = std::string_view{ };
+        auto error = field.unescaped_key( ).get( key );
+
+        if ( !error && key == "program" )
+            error = field.value( ).get_string( ).get( path );
+        else if ( !error && key == "stopOnEntry" )
+            error = field.value( ).get_bool( ).get( is_on_entry );
+        else if ( !error && key == "speed" )
+            error = field.value( ).get_uint64( ).get( ips );
+        else if ( !error && key == "seed" )
+            error = field.value( ).get_uint64( ).get( seed );
+        else if ( !error && key == "legacy" )
+            error = field.value( ).get_bool( ).get( is_legacy );
+        else if ( !error && key == "stackLimit" )
+            error = field.value( ).get_bool( ).get( is_limited );
+
+        if ( error )
+            return false;
+    }
+
+    if ( path.empty( ) )
+        return false;
+
+    program       = path;
+    speed         = uint32_t( std::clamp( ips, uint64_t( 60 ), uint64_t( UINT32_MAX ) ) );
+    stop_on_entry = is_on_entry;
+
+    // History replays with step, idle loop skipping would shift cycle counts.
+    chip8_instance.set_option( ecc_option_print, false );
+    chip8_instance.set_option( ecc_option_idle, false );
+    chip8_instance.set_option( ecc_option_legacy, is_legacy );
+    // Stack option set means an unlimited call stack.
+    chip8_instance.set_option( ecc_option_stack, !is_limited );
+    chip8_instance.set_random_seed( seed );
+    chip8_instance.override_key_callback( chip8_cpu_implementation::exec_get_key_latch );
+
+    if ( !chip8_instance.load_rom( program.c_str( ) ) )
+        return false;
+
+    chip8_instance.reset( );
+
+    history.reset( chip8_instance );
+    disassembly.invalidate( );
+
+    is_launched = true;
+
+    return true;
+}
+
+void chip8_dap::set_breakpoints(
+    const echip8_dap_command& command,
+    chip8& chip8_instance
+) {
+    const auto rom_size = chip8_instance.get_rom( ).get_size( );
+
+    auto arguments = simdjson::ondemand::object{ };
+    auto requested = simdjson::ondemand::array{ };
+    auto lines     = std::vector<std::pair<int64_t, chip8_string>>{ };
+
+    breakpoints.clear( );
+    chip8_instance.clear_breakpoints( );
+
+    if ( !document[ "arguments" ].get_object( ).get( arguments ) && !arguments[ "breakpoints" ].get_array( ).get( requested ) ) {
+        for ( auto requested_breakpoint : requested ) {
+            auto requested_object = simdjson::ondemand::object{ };
+            auto line             = int64_t( 0 );
+            auto condition        = std::string_view{ };
+            auto hit_condition    = std::string_view{ };
+            auto log_message      = std::string_view{ };
+            auto breakpoint       = chip8_dap_breakpoint{ };
+
+            if ( requested_breakpoint.get_object( ).get( requested_object ) ) {
+                lines.emplace_back( 0, "Invalid breakpoint." );
+
+                continue;
+            }
+
+            // Single pass over members, strings stay valid until next request.
+            for ( auto field : requested_object ) {
+                auto key   = std::string_view{ };
+                auto error = field.unescaped_key( ).get( key );
+
+                if ( !error && key == "line" )
+                    error = field.value( ).get_int64( ).get( line );
+                else if ( !error && key == "condition" )
+                    error = field.value( ).get_string( ).get( condition );
+                else if ( !error && key == "hitCondition" )
+                    error = field.value( ).get_string( ).get( hit_condition );
+                else if ( !error && key == "logMessage" )
+                    error = field.value( ).get_string( ).get( log_message );
+
+                if ( error )
+                    line = 0;
+            }
+
+            const auto offset = ( line - 1 ) * 2;
+
+            if ( line <= 0 || ( is_launched && int64_t( rom_size ) <= offset ) )
+                lines.emplace_back( line, "Line is outside of the program." );
+            else if ( !breakpoint.compile( condition, hit_condition, log_message ) )
+                lines.emplace_back( line, "Invalid condition." );
+            else {
+                lines.emplace_back( line, nullptr );
+
+                breakpoints.insert_or_assign( uint16_t( offset ), std::move( breakpoint ) );
+                chip8_instance.set_breakpoint( uint16_t( offset ), true );
+            }
+        }
+    }
+
+    // A running step over keep its return breakpoint.
+    if ( stop_pc != NoStop )
+        chip8_instance.set_breakpoint( stop_pc, true );
+
+    writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+    writer.begin_object( "body" );
+    writer.begin_array( "breakpoints" );
+
+    for ( const auto& [ line, message ] : lines ) {
+        writer.begin_object( nullptr );
+        writer.add_bool( "verified", message == nullptr );
+        writer.add_number( "line", line );
+
+        if ( message != nullptr )
+            writer.add_string( "message", message );
+
+        writer.end_object( );
+    }
+
+    writer.end_array( );
+    writer.end_object( );
+    writer.send( );
+}
+
+void chip8_dap::step( chip8& chip8_instance, const bool step_over ) {
+    if ( !is_launched )
+        return;
+
+    const auto& hot    = chip8_instance.get_hot_state( );
+    const auto* memory = chip8_instance.get_mmu( ).get_rom_memory( );
+    const auto cpu_pc  = hot.PC;
+
+    auto state = ecs_wfk;
+
+    // Run over a call like any instruction, stopping on its return.
+    if ( step_over && cpu_pc + 1u < chip8_memory_manager_unit::Capacity - eca_rom_start && ( memory[ cpu_pc ] >> 4 ) == 0x2 ) {
+        set_stop( chip8_instance, uint16_t( cpu_pc + 2 ), chip8_instance.get_mmu( ).get_stack( ).get_depth( ) );
+
+        is_running = true;
+
+        return;
+    }
+
+    // Stepping a key wait keep waiting with running timers.
+    for ( auto count = uint32_t( 0 ); state == ecs_wfk && count < speed; count++ )
+        state = chip8_instance.step( speed );
+
+    history.record( chip8_instance );
+
+    if ( state != ecs_run && state != ecs_wfk )
+        send_terminated( chip8_instance, state );
+    else
+        send_stopped( chip8_instance, "step" );
+}
+
+void chip8_dap::reverse( chip8& chip8_instance, const bool to_breakpoint ) {
+    if ( !is_launched )
+        return;
+
+    const auto& hot = chip8_instance.get_hot_state( );
+
+    auto end_cycle = hot.cycles;
+    auto target    = to_breakpoint || end_cycle == 0 ? end_cycle : end_cycle - 1;
+    auto reason    = to_breakpoint ? "entry" : "step";
+
+    // Replay each interval from the newest, the last breakpoint reached
+    // before its end is the target.
+    for ( auto snapshot_id = history.get_count( ); to_breakpoint && snapshot_id-- > 0; ) {
+        const auto& snapshot = history.get_snapshot( snapshot_id );
+        auto found_cycle     = end_cycle;
+
+        chip8_instance.load_state( snapshot );
+
+        while ( hot.cycles < end_cycle ) {
+            const auto breakpoint = breakpoints.find( hot.PC );
+
+            if ( breakpoint != breakpoints.end( ) && !breakpoint->second.get_is_logpoint( ) && breakpoint->second.get_is_true( chip8_instance ) )
+                found_cycle = hot.cycles;
+
+            const auto state = chip8_instance.step( speed );
+
+            if ( state != ecs_run && state != ecs_wfk )
+                break;
+        }
+
+        if ( found_cycle < end_cycle ) {
+            target = found_cycle;
+            reason = "breakpoint";
+            break;
+        }
+
+        end_cycle = snapshot.hot.cycles;
+        target    = end_cycle;
+    }
+
+    if ( !history.seek( chip8_instance, target, speed ) )
+        history.seek( chip8_instance, history.get_snapshot( 0 ).hot.cycles, speed );
+
+    send_stopped( chip8_instance, reason );
+}
+
+void chip8_dap::check_breakpoint( chip8& chip8_instance ) {
+    const auto cpu_pc = chip8_instance.get_hot_state( ).PC;
+
+    if ( cpu_pc == stop_pc && chip8_instance.get_mmu( ).get_stack( ).get_depth( ) <= stop_depth ) {
+        send_stopped( chip8_instance, "step" );
+
+        return;
+    }
+
+    // A step over return reached deeper in a recursion keep running.
+    auto breakpoint = breakpoints.find( cpu_pc );
+
+    if ( breakpoint == breakpoints.end( ) )
+        return;
+
+    switch ( breakpoint->second.hit( chip8_instance ) ) {
+        case ecd_action_log  : send_output( breakpoint->second.get_log( chip8_instance ), true ); break;
+        case ecd_action_stop : send_stopped( chip8_instance, "breakpoint" ); break;
+
+        default : break;
+    }
+}
+
+void chip8_dap::set_stop(
+    chip8& chip8_instance,
+    const uint16_t cpu_pc,
+    const uint8_t depth
+) {
+    if ( stop_pc != NoStop && !breakpoints.contains( stop_pc ) )
+        chip8_instance.set_breakpoint( stop_pc, false );
+
+    if ( cpu_pc != NoStop )
+        chip8_instance.set_breakpoint( cpu_pc, true );
+
+    stop_pc    = cpu_pc;
+    stop_depth = depth;
+}
+
+void chip8_dap::send_stack_trace(
+    const echip8_dap_command& command,
+    chip8& chip8_instance
+) {
+    const auto& stack = chip8_instance.get_mmu( ).get_stack( );
+    const auto depth  = stack.get_depth( );
+    const auto name   = std::filesystem::path( program ).filename( ).string( );
+
+    writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+    writer.begin_object( "body" );
+    writer.begin_array( "stackFrames" );
+
+    // Frame 0 is the current PC, then call sites from innermost.
+    for ( auto frame_id = uint32_t( 0 ); frame_id <= depth; frame_id++ ) {
+        const auto cpu_pc  = frame_id == 0 ? chip8_instance.get_hot_state( ).PC : uint16_t( stack.get( uint8_t( depth - frame_id ) ) - 2 );
+        const auto address = get_address( cpu_pc );
+
+        writer.begin_object( nullptr );
+        writer.add_number( "id", frame_id );
+        writer.add_string( "name", address );
+        writer.begin_object( "source" );
+        writer.add_string( "name", name );
+        writer.add_string( "path", program );
+        writer.end_object( );
+        writer.add_number( "line", cpu_pc / 2 + 1 );
+        writer.add_number( "column", 1 );
+        writer.add_string( "instructionPointerReference", address );
+        writer.end_object( );
+    }
+
+    writer.end_array( );
+    writer.add_number( "totalFrames", depth + 1 );
+    writer.end_object( );
+    writer.send( );
+}
+
+void chip8_dap::send_variables(
+    const echip8_dap_command& command,
+    chip8& chip8_instance
+) {
+    const auto& hot = chip8_instance.get_hot_state( );
+
+    auto reference = int64_t( 0 );
+    auto text      = std::array<char, 16>{ };
+
+    if ( document[ "arguments" ][ "variablesReference" ].get_int64( ).get( reference ) || reference != RegistersScope ) {
+        send_error( command, "Unknown variables reference." );
+
+        return;
+    }
+
+    // Address values are memory references, so IDEs can open memory.
+    auto add_variable = [ & ]( chip8_string name, chip8_string format, const uint32_t value, const bool is_address ) -> void {
+        snprintf( text.data( ), text.size( ), format, value );
+
+        writer.begin_object( nullptr );
+        writer.add_string( "name", name );
+        writer.add_string( "value", text.data( ) );
+        writer.add_number( "variablesReference", 0 );
+
+        if ( is_address )
+            writer.add_string( "memoryReference", text.data( ) );
+
+        writer.end_object( );
+    };
+
+    writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+    writer.begin_object( "body" );
+    writer.begin_array( "variables" );
+
+    for ( auto register_id = uint32_t( 0 ); register_id < hot.V.size( ); register_id++ ) {
+        static constexpr chip8_string Names[ 16 ] = {
+            "V0", "V1", "V2", "V3", "V4", "V5", "V6", "V7",
+            "V8", "V9", "VA", "VB", "VC", "VD", "VE", "VF"
+        };
+
+        add_variable( Names[ register_id ], "0x%02X", hot.V[ register_id ], false );
+    }
+
+    add_variable( "I", "0x%03X", hot.I, true );
+    add_variable( "PC", "0x%03X", uint32_t( hot.PC + eca_rom_start ), true );
+    add_variable( "SP", "%u", chip8_instance.get_mmu( ).get_stack( ).get_depth( ), false );
+    add_variable( "DT", "%u", hot.delay_timer, false );
+    add_variable( "ST", "%u", hot.sound_timer, false );
+
+    writer.end_array( );
+    writer.end_object( );
+    writer.send( );
+}
+
+void chip8_dap::send_disassembly(
+    const echip8_dap_command& command,
+    chip8& chip8_instance
+) {
+    const auto& mmu     = chip8_instance.get_mmu( );
+    const auto* memory  = mmu.get_memory( );
+    const auto rom_size = int64_t( chip8_instance.get_rom( ).get_size( ) );
+    const auto name     = std::filesystem::path( program ).filename( ).string( );
+
+    auto arguments   = simdjson::ondemand::object{ };
+    auto reference   = std::string_view{ };
+    auto offset      = int64_t( 0 );
+    auto instruction = int64_t( 0 );
+    auto count       = int64_t( 0 );
+    auto text        = std::array<char, 8>{ };
+
+    if ( document[ "arguments" ].get_object( ).get( arguments ) ) {
+        send_error( command, "Missing arguments." );
+
+        return;
+    }
+
+    for ( auto field : arguments ) {
+        auto key   = std::string_view{ };
+        auto error = field.unescaped_key( ).get( key );
+
+        if ( !error && key == "memoryReference" )
+            error = field.value( ).get_string( ).get( reference );
+        else if ( !error && key == "offset" )
+            error = field.value( ).get_int64( ).get( offset );
+        else if ( !error && key == "instructionOffset" )
+            error = field.value( ).get_int64( ).get( instruction );
+        else if ( !error && key == "instructionCount" )
+            error = field.value( ).get_int64( ).get( count );
+
+        if ( error )
+            count = -1;
+    }
+
+    const auto base = get_reference( reference );
+
+    if ( base < 0 || count < 0 || count > MaxDisassembly ) {
+        send_error( command, "Invalid disassemble request." );
+
+        return;
+    }
+
+    writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+    writer.begin_object( "body" );
+    writer.begin_array( "instructions" );
+
+    // Instructions are 2 bytes, the window may start before memory.
+    for ( auto instruction_id = int64_t( 0 ); instruction_id < count; instruction_id++ ) {
+        const auto address  = base + offset + ( instruction + instruction_id ) * 2;
+        const auto is_valid = 0 <= address && address + 1 < chip8_memory_manager_unit::Capacity;
+        const auto cpu_pc   = address - eca_rom_start;
+
+        snprintf( text.data( ), text.size( ), "0x%03X", uint32_t( address ) & 0xFFFF );
+
+        writer.begin_object( nullptr );
+        writer.add_string( "address", is_valid ? text.data( ) : "0x000" );
+
+        if ( is_valid ) {
+            snprintf( text.data( ), text.size( ), "%02X %02X", memory[ address ], memory[ address + 1 ] );
+
+            writer.add_string( "instructionBytes", text.data( ) );
+            writer.add_string( "instruction", disassembly.get( mmu, uint16_t( address ) ) );
+        } else {
+            writer.add_string( "instruction", "??" );
+            writer.add_string( "presentationHint", "invalid" );
+        }
+
+        // ROM instructions point back to their source line.
+        if ( is_valid && 0 <= cpu_pc && cpu_pc < rom_size && cpu_pc % 2 == 0 ) {
+            writer.begin_object( "location" );
+            writer.add_string( "name", name );
+            writer.add_string( "path", program );
+            writer.end_object( );
+            writer.add_number( "line", cpu_pc / 2 + 1 );
+        }
+
+        writer.end_object( );
+    }
+
+    writer.end_array( );
+    writer.end_object( );
+    writer.send( );
+}
+
+void chip8_dap::send_memory(
+    const echip8_dap_command& command,
+    chip8& chip8_instance
+) {
+    auto arguments = simdjson::ondemand::object{ };
+    auto reference = std::string_view{ };
+    auto offset    = int64_t( 0 );
+    auto count     = int64_t( 0 );
+    auto text      = std::array<char, 8>{ };
+
+    if ( document[ "arguments" ].get_object( ).get( arguments ) ) {
+        send_error( command, "Missing arguments." );
+
+        return;
+    }
+
+    for ( auto field : arguments ) {
+        auto key   = std::string_view{ };
+        auto error = field.unescaped_key( ).get( key );
+
+        if ( !error && key == "memoryReference" )
+            error = field.value( ).get_string( ).get( reference );
+        else if ( !error && key == "offset" )
+            error = field.value( ).get_int64( ).get( offset );
+        else if ( !error && key == "count" )
+            error = field.value( ).get_int64( ).get( count );
+
+        if ( error )
+            count = -1;
+    }
+
+    const auto base = get_reference( reference );
+
+    if ( base < 0 || count < 0 ) {
+        send_error( command, "Invalid readMemory request." );
+
+        return;
+    }
+
+    // Readable part is clamped to memory, the rest is unreadable.
+    const auto address = std::clamp( base + offset, int64_t( 0 ), int64_t( chip8_memory_manager_unit::Capacity ) );
+    const auto size    = std::clamp( std::min( base + offset + count, int64_t( chip8_memory_manager_unit::Capacity ) ) - address, int64_t( 0 ), count );
+
+    snprintf( text.data( ), text.size( ), "0x%03X", uint32_t( address ) );
+
+    writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+    writer.begin_object( "body" );
+    writer.add_string( "address", text.data( ) );
+    writer.add_base64( "data", chip8_instance.get_mmu( ).get_memory( ) + address, size_t( size ) );
+
+    if ( size < count )
+        writer.add_number( "unreadableBytes", count - size );
+
+    writer.end_object( );
+    writer.send( );
+}
+
+void chip8_dap::write_memory(
+    const echip8_dap_command& command,
+    chip8& chip8_instance
+) {
+    auto arguments  = simdjson::ondemand::object{ };
+    auto reference  = std::string_view{ };
+    auto data       = std::string_view{ };
+    auto offset     = int64_t( 0 );
+    auto is_partial = false;
+    auto is_valid   = true;
+    auto bytes      = std::vector<uint8_t>{ };
+
+    if ( document[ "arguments" ].get_object( ).get( arguments ) ) {
+        send_error( command, "Missing arguments." );
+
+        return;
+    }
+
+    for ( auto field : arguments ) {
+        auto key   = std::string_view{ };
+        auto error = field.unescaped_key( ).get( key );
+
+        if ( !error && key == "memoryReference" )
+            error = field.value( ).get_string( ).get( reference );
+        else if ( !error && key == "offset" )
+            error = field.value( ).get_int64( ).get( offset );
+        else if ( !error && key == "allowPartial" )
+            error = field.value( ).get_bool( ).get( is_partial );
+        else if ( !error && key == "data" )
+            error = field.value( ).get_string( ).get( data );
+
+        if ( error )
+            is_valid = false;
+    }
+
+    const auto address  = get_reference( reference ) + offset;
+    const auto capacity = int64_t( chip8_memory_manager_unit::Capacity );
+
+    if ( !is_valid || !get_bytes( data, bytes ) || address < 0 || capacity <= address ) {
+        send_error( command, "Invalid writeMemory request." );
+
+        return;
+    }
+
+    const auto size = std::min( int64_t( bytes.size( ) ), capacity - address );
+
+    if ( size < int64_t( bytes.size( ) ) && !is_partial ) {
+        send_error( command, "Write goes past memory end." );
+
+        return;
+    }
+
+    auto& mmu = chip8_instance.get_mmu( );
+
+    // Writes bump page generations, cached disassembly follows.
+    for ( auto byte_id = int64_t( 0 ); byte_id < size; byte_id++ )
+        mmu.write( uint16_t( address + byte_id ), bytes[ byte_id ] );
+
+    // Snapshots hold the old memory, replaying them would undo the write.
+    if ( is_launched )
+        history.reset( chip8_instance );
+
+    writer.begin_response( command.payload.request.sequence, command.payload.request.name, true );
+    writer.begin_object( "body" );
+    writer.add_number( "offset", offset );
+    writer.add_number( "bytesWritten", size );
+    writer.end_object( );
+    writer.send( );
+}
+
+void chip8_dap::send_error( const echip8_dap_command& command, chip8_string message ) {
+    writer.begin_response( command.payload.request.sequence, command.payload.request.name, false );
+    writer.add_string( "message", message );
+    writer.send( );
+}
+
+void chip8_dap::send_stopped( chip8& chip8_instance, chip8_string reason ) {
+    set_stop( chip8_instance, NoStop, 0 );
+
+    is_running = false;
+
+    writer.begin_event( "stopped" );
+    writer.begin_object( "body" );
+    writer.add_string( "reason", reason );
+    writer.add_number( "threadId", ThreadId );
+    writer.add_bool( "allThreadsStopped", true );
+    writer.end_object( );
+    writer.send( );
+}
+
+void chip8_dap::send_terminated( chip8& chip8_instance, const echip8_states state ) {
+    auto text = std::array<char, 64>{ };
+
+    is_running  = false;
+    is_launched = false;
+
+    snprintf( text.data( ), text.size( ), "> Program ended : %s\n", chip8_metrics::get_state_name( state ) );
+
+    send_output( text.data( ), false );
+
+    writer.begin_event( "exited" );
+    writer.begin_object( "body" );
+    writer.add_number( "exitCode", state == ecs_epv ? chip8_instance.get_exit_code( ) : state == ecs_eop ? 0 : state );
+    writer.end_object( );
+    writer.send( );
+
+    writer.begin_event( "terminated" );
+    writer.send( );
+}
+
+void chip8_dap::send_output( std::string_view text, const bool can_drop ) {
+    writer.begin_event( "output" );
+    writer.begin_object( "body" );
+    writer.add_string( "category", "console" );
+    writer.add_string( "output", text );
+    writer.end_object( );
+    writer.send( can_drop );
+}
+
+void chip8_dap::read_requests( chip8& chip8_instance ) {
+    auto message = std::string{ };
+
+    // Poll with a timeout, a closed channel end the thread even when
+    // the client keep stdin open.
+    while ( !requests.get_is_closed( ) ) {
+        if ( !reader.get_has_input( PollTimeout ) )
+            continue;
+
+        const auto body = reader.receive( );
+
+        if ( body.empty( ) && reader.get_is_closed( ) )
+            break;
+
+        // The reader buffer is refilled by the next receive, the body is
+        // copied once into a recycled padded request.
+        message.reserve( body.size( ) + simdjson::SIMDJSON_PADDING );
+        message.assign( body );
+
+        requests.push( message, false );
+
+        // End a running slice now, not after SliceSize instructions.
+        chip8_instance.interrupt( );
+    }
+
+    requests.close( );
+}
+
+void chip8_dap::write_events( ) {
+    auto message = std::string{ };
+
+    while ( events.wait( ) ) {
+        while ( events.pop( message ) ) {
+            if ( !chip8_dap_writer::write( message ) ) {
+                events.close( );
+
+                return;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+echip8_dap_command_types chip8_dap::get_command_type( std::string_view name ) {
+    static constexpr std::string_view Names[ ecd_command_unknown ] = {
+        "initialize", "launch", "configurationDone", "setBreakpoints", "continue", "next",
+        "stepIn", "stepBack", "reverseContinue", "pause", "threads", "stackTrace", "scopes",
+        "variables", "disassemble", "readMemory", "writeMemory", "disconnect"
+    };
+
+    for ( auto command_id = uint32_t( 0 ); command_id < ecd_command_unknown; command_id++ ) {
+        if ( Names[ command_id ] == name )
+            return echip8_dap_command_types( command_id );
+    }
+
+    return ecd_command_unknown;
+}
+
+std::string chip8_dap::get_address( const uint16_t cpu_pc ) {
+    auto text = std::array<char, 8>{ };
+
+    snprintf( text.data( ), text.size( ), "0x%03X", ( cpu_pc + eca_rom_start ) & 0xFFFF );
+
+    return text.data( );
+}
+
+int64_t chip8_dap::get_reference( std::string_view reference ) {
+    const auto text = std::string{ reference };
+
+    auto* text_end   = (char*)nullptr;
+    const auto value = std::strtoll( text.c_str( ), &text_end, 0 );
+
+    if ( text.empty( ) || text_end != text.c_str( ) + text.size( ) || value < 0 )
+        return -1;
+
+    return value;
+}
+
+bool chip8_dap::get_bytes( std::string_view text, std::vector<uint8_t>& bytes ) {
+    auto group = uint32_t( 0 );
+    auto bits  = uint32_t( 0 );
+
+    bytes.clear( );
+    bytes.reserve( text.size( ) * 3 / 4 );
+
+    for ( const auto character : text ) {
+        auto value = uint32_t( 0 );
+
+        if ( 'A' <= character && character <= 'Z' )
+            value = uint32_t( character - 'A' );
+        else if ( 'a' <= character && character <= 'z' )
+            value = uint32_t( character - 'a' + 26 );
+        else if ( '0' <= character && character <= '9' )
+            value = uint32_t( character - '0' + 52 );
+        else if ( character == '+' )
+            value = 62;
+        else if ( character == '/' )
+            value = 63;
+        else if ( character == '=' )
+            break;
+        else
+            return false;
+
+        group = ( group << 6 ) | value;
+        bits += 6;
+
+        if ( bits >= 8 ) {
+            bits -= 8;
+
+            bytes.emplace_back( uint8_t( group >> bits ) );
+        }
+    }
+
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC STATIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
-int chip8_dap::run( int argc, char** argv ) {
-    auto emulator_dap = chip8_dap{ };
+int chip8_dap::run( [[maybe_unused]] int argc, [[maybe_unused]] char** argv ) {
+    auto emulator_dap = std::make_unique<chip8_dap>( );
+    auto emulator     = std::make_unique<chip8>( false, false, true );
     auto dap_command  = echip8_dap_command{ };
-    auto emulator     = chip8{ };
+
+    emulator->set_option( ecc_option_virtual, true );
+    emulator->set_option( ecc_option_limit, false );
+
+    auto reader_thread = std::thread( [ &emulator_dap, &emulator ]( ) -> void { emulator_dap->read_requests( *emulator ); } );
+    auto writer_thread = std::thread( [ &emulator_dap ]( ) -> void { emulator_dap->write_events( ); } );
 
     do {
-        dap_command = emulator_dap.receive_command( );
-    } while ( emulator_dap.execute_command( dap_command, emulator ) );
+        // Requests are handled between slices while the machine runs.
+        while ( emulator_dap->get_is_running( ) && !emulator_dap->get_has_input( ) )
+            emulator_dap->execute_slice( *emulator );
+
+        dap_command = emulator_dap->receive_command( );
+    } while ( emulator_dap->execute_command( dap_command, *emulator ) );
+
+    // Pending messages, disconnect response included, are written first.
+    emulator_dap->requests.close( );
+    emulator_dap->events.close( );
+
+    reader_thread.join( );
+    writer_thread.join( );
 
     return 0;
 }
@@ -38,5 +955,37 @@ int chip8_dap::run( int argc, char** argv ) {
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 echip8_dap_command chip8_dap::receive_command( ) {
-    return { ecd_command_quit, { } };
+    while ( true ) {
+        if ( !requests.pop( request ) ) {
+            if ( !requests.wait( ) )
+                return { ecd_command_quit, { } };
+
+            continue;
+        }
+
+        // The reader thread reserved the padding behind each request.
+        const auto padded = simdjson::padded_string_view( request.data( ), request.size( ), request.capacity( ) );
+
+        auto command = echip8_dap_command{ ecd_command_unknown, { } };
+        auto name    = std::string_view{ };
+
+        if ( parser.iterate( padded ).get( document ) )
+            continue;
+
+        if ( document[ "seq" ].get_int64( ).get( command.payload.request.sequence ) || document[ "command" ].get_string( ).get( name ) )
+            continue;
+
+        command.type                 = get_command_type( name );
+        command.payload.request.name = name;
+
+        return command;
+    }
+}
+
+bool chip8_dap::get_is_running( ) const {
+    return is_running;
+}
+
+bool chip8_dap::get_has_input( ) const {
+    return !requests.empty( );
 }
@@ -1,19 +1,42 @@
 #pragma once
 
-#include "chip8.h"
+#include "chip8_dap_disassembly.h"
 
 /**
  * Define all supported commands.
  **/
 enum echip8_dap_command_types : uint8_t {
-    ecd_command_init = 0,
+    ecd_command_initialize = 0,
+    ecd_command_launch,
+    ecd_command_configuration_done,
+    ecd_command_set_breakpoints,
+    ecd_command_continue,
     ecd_command_next,
+    ecd_command_step_in,
+    ecd_command_step_back,
+    ecd_command_reverse_continue,
+    ecd_command_pause,
+    ecd_command_threads,
+    ecd_command_stack_trace,
+    ecd_command_scopes,
+    ecd_command_variables,
+    ecd_command_disassemble,
+    ecd_command_read_memory,
+    ecd_command_write_memory,
+    ecd_command_disconnect,
+    ecd_command_unknown,
     ecd_command_quit,
     ecd_command_count
 };
 
+/**
+ * Define a request payload.
+ * @field sequence : Request sequence number.
+ * @field name : Request command name, valid until next receive.
+ **/
 struct echip8_dap_payload_request {
-    int sequence = 0;
+    int64_t sequence = 0;
+    std::string_view name;
 };
 
 union echip8_dap_payload {
@@ -27,23 +50,283 @@ struct echip8_dap_command {
 
 /**
  * chip8_dap class
- * @note Define Debug Adapter (DAP) for chip8 emulator.
+ * @note Define Debug Adapter (DAP) for chip8 emulator, serve one
+ *       debug session over stdio. A reader thread frame requests and
+ *       a writer thread write responses and events, both joined to
+ *       the emulation thread by lock-free channels, so a slow client
+ *       never stall the machine. Requests are parsed in place with
+ *       simdjson On-Demand and the machine runs between requests in
+ *       slices, so a pending request is handled within a slice.
+ *       Source lines map to instructions, line L is the instruction
+ *       at ROM offset ( L - 1 ) * 2. Continue runs at full speed
+ *       against the machine breakpoint bitmap, conditions only run
+ *       on a bitmap hit. Reverse requests seek back through the
+ *       snapshot history. Memory references are memory addresses
+ *       like "0x200".
  **/
 class chip8_dap final {
 
+public:
+    static constexpr uint32_t SliceSize     = 16384;
+    static constexpr uint16_t NoStop        = 0xFFFF;
+    static constexpr int64_t ThreadId       = 1;
+    static constexpr int64_t RegistersScope = 1;
+    static constexpr int32_t PollTimeout    = 50;
+    static constexpr int64_t MaxDisassembly = 4096;
+
+private:
+    chip8_dap_channel requests;
+    chip8_dap_channel events;
+    chip8_dap_reader reader;
+    chip8_dap_writer writer;
+    std::string request;
+    simdjson::ondemand::parser parser;
+    simdjson::ondemand::document document;
+    std::map<uint16_t, chip8_dap_breakpoint> breakpoints;
+    chip8_dap_history history;
+    chip8_dap_disassembly disassembly;
+    std::string program;
+    uint32_t speed;
+    bool is_launched;
+    bool is_running;
+    bool stop_on_entry;
+    uint16_t stop_pc;
+    uint8_t stop_depth;
+
 public:
     /**
      * Constructor
      **/
     chip8_dap( );
 
+    /**
+     * send_response method
+     * @note Send an empty response to a request.
+     * @param command : Target request.
+     **/
     void send_response( const echip8_dap_command& command );
 
+    /**
+     * execute_command function
+     * @note Execute a request against the machine.
+     * @param command : Target request.
+     * @param chip8_instance : Target machine.
+     * @return False when the session ended.
+     **/
     bool execute_command(
         const echip8_dap_command& command,
         chip8& chip8_instance
     );
 
+    /**
+     * execute_slice method
+     * @note Run the machine up to SliceSize instructions, until a
+     *       breakpoint stop, a step end, the program end or a request
+     *       interrupt.
+     * @param chip8_instance : Target machine.
+     **/
+    void execute_slice( chip8& chip8_instance );
+
+private:
+    /**
+     * launch function
+     * @note Load the launch request program and its options.
+     * @param chip8_instance : Target machine.
+     * @return True when the program was loaded.
+     **/
+    bool launch( chip8& chip8_instance );
+
+    /**
+     * set_breakpoints method
+     * @note Replace breakpoints and answer verified lines.
+     * @param command : Target request.
+     * @param chip8_instance : Target machine.
+     **/
+    void set_breakpoints(
+        const echip8_dap_command& command,
+        chip8& chip8_instance
+    );
+
+    /**
+     * step method
+     * @note Start a step, over 2NNN calls when requested.
+     * @param chip8_instance : Target machine.
+     * @param step_over : True to run subroutine calls to return.
+     **/
+    void step( chip8& chip8_instance, const bool step_over );
+
+    /**
+     * reverse method
+     * @note Go back one instruction, or to the last instruction that
+     *       reached a breakpoint whose condition hold. Hit conditions
+     *       and logpoints are ignored backward, the oldest snapshot
+     *       is reached when no breakpoint is found.
+     * @param chip8_instance : Target machine.
+     * @param to_breakpoint : True to go back to a breakpoint.
+     **/
+    void reverse( chip8& chip8_instance, const bool to_breakpoint );
+
+    /**
+     * check_breakpoint method
+     * @note Handle a bitmap hit, stop on a step end or on a breakpoint
+     *       whose condition and hit condition pass, logpoints send
+     *       their message and keep running.
+     * @param chip8_instance : Target machine.
+     **/
+    void check_breakpoint( chip8& chip8_instance );
+
+    /**
+     * set_stop method
+     * @note Set step over return, its bitmap entry included.
+     * @param chip8_instance : Target machine.
+     * @param cpu_pc : Return ROM offset, NoStop for none.
+     * @param depth : Maximum stack depth of the return.
+     **/
+    void set_stop(
+        chip8& chip8_instance,
+        const uint16_t cpu_pc,
+        const uint8_t depth
+    );
+
+    /**
+     * send_stack_trace method
+     * @note Answer current PC then each call site.
+     * @param command : Target request.
+     * @param chip8_instance : Target machine.
+     **/
+    void send_stack_trace(
+        const echip8_dap_command& command,
+        chip8& chip8_instance
+    );
+
+    /**
+     * send_variables method
+     * @note Answer registers, index, timers and stack pointer.
+     * @param command : Target request.
+     * @param chip8_instance : Target machine.
+     **/
+    void send_variables(
+        const echip8_dap_command& command,
+        chip8& chip8_instance
+    );
+
+    /**
+     * send_disassembly method
+     * @note Answer cached disassembly, addresses out of memory are
+     *       answered as invalid instructions.
+     * @param command : Target request.
+     * @param chip8_instance : Target machine.
+     **/
+    void send_disassembly(
+        const echip8_dap_command& command,
+        chip8& chip8_instance
+    );
+
+    /**
+     * send_memory method
+     * @note Answer a memory read, encoded straight from machine memory.
+     * @param command : Target request.
+     * @param chip8_instance : Target machine.
+     **/
+    void send_memory(
+        const echip8_dap_command& command,
+        chip8& chip8_instance
+    );
+
+    /**
+     * write_memory method
+     * @note Write memory through the memory manager, history restart
+     *       from the modified machine.
+     * @param command : Target request.
+     * @param chip8_instance : Target machine.
+     **/
+    void write_memory(
+        const echip8_dap_command& command,
+        chip8& chip8_instance
+    );
+
+    /**
+     * send_error method
+     * @note Answer a failed request.
+     * @param command : Target request.
+     * @param message : Error message.
+     **/
+    void send_error( const echip8_dap_command& command, chip8_string message );
+
+    /**
+     * send_stopped method
+     * @note Stop running and send a stopped event.
+     * @param chip8_instance : Target machine.
+     * @param reason : DAP stop reason.
+     **/
+    void send_stopped( chip8& chip8_instance, chip8_string reason );
+
+    /**
+     * send_terminated method
+     * @note Stop running and send exited then terminated events.
+     * @param chip8_instance : Target machine.
+     * @param state : Final execution state.
+     **/
+    void send_terminated( chip8& chip8_instance, const echip8_states state );
+
+    /**
+     * send_output method
+     * @note Send a console output event.
+     * @param text : Output text.
+     * @param can_drop : True to drop the event when the client is late.
+     **/
+    void send_output( std::string_view text, const bool can_drop );
+
+    /**
+     * read_requests method
+     * @note Reader thread, frame requests from stdin into the request
+     *       channel until stdin or the channel is closed, and interrupt
+     *       the machine so a running slice ends on the next instruction.
+     * @param chip8_instance : Target machine.
+     **/
+    void read_requests( chip8& chip8_instance );
+
+    /**
+     * write_events method
+     * @note Writer thread, write posted messages to stdout until the
+     *       event channel is closed and drained.
+     **/
+    void write_events( );
+
+private:
+    /**
+     * get_command_type function
+     * @note Get command type from its name.
+     * @param name : Command name.
+     * @return Command type, ecd_command_unknown when unsupported.
+     **/
+    static echip8_dap_command_types get_command_type( std::string_view name );
+
+    /**
+     * get_address function
+     * @note Get memory address of a ROM offset.
+     * @param cpu_pc : ROM offset.
+     * @return Hexadecimal memory address like "0x200".
+     **/
+    static std::string get_address( const uint16_t cpu_pc );
+
+    /**
+     * get_reference function
+     * @note Get memory address from a memory reference.
+     * @param reference : Memory reference like "0x200".
+     * @return Memory address, -1 when invalid.
+     **/
+    static int64_t get_reference( std::string_view reference );
+
+    /**
+     * get_bytes function
+     * @note Decode a base64 string.
+     * @param text : Base64 text.
+     * @param bytes : Decoded bytes.
+     * @return False when text isn't base64.
+     **/
+    static bool get_bytes( std::string_view text, std::vector<uint8_t>& bytes );
+
 public:
     /**
      * run function
@@ -55,6 +338,25 @@ public:
     static int run( int argc, char** argv );
 
 public:
+    /**
+     * receive_command function
+     * @note Wait for the next framed request and parse its command.
+     * @return Request, ecd_command_quit when stdin was closed.
+     **/
     echip8_dap_command receive_command( );
 
+    /**
+     * get_is_running function
+     * @note Get if the machine runs between requests.
+     * @return True when the machine runs.
+     **/
+    bool get_is_running( ) const;
+
+    /**
+     * get_has_input function
+     * @note Get if a request is pending, never block.
+     * @return True when a request is pending.
+     **/
+    bool get_has_input( ) const;
+
 };
@@ -0,0 +1,274 @@
+#include "chip8_dap.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_dap_breakpoint::chip8_dap_breakpoint( )
+    : condition{ },
+    hit_compare{ ecd_compare_ge },
+    hit_target{ 0 },
+    log_message{ },
+    hit_count{ 0 },
+    has_hit_condition{ false }
+{ }
+
+bool chip8_dap_breakpoint::compile(
+    std::string_view condition_text,
+    std::string_view hit_text,
+    std::string_view log_text
+) {
+    condition.clear( );
+
+    log_message       = log_text;
+    hit_count         = 0;
+    has_hit_condition = false;
+
+    // Disjunction of conjunctions, && bind tighter than ||.
+    for ( auto text = trim( condition_text ); !text.empty( ); ) {
+        const auto or_split = text.find( "||" );
+        auto group          = trim( text.substr( 0, or_split ) );
+
+        condition.emplace_back( );
+
+        while ( !group.empty( ) ) {
+            const auto and_split = group.find( "&&" );
+            auto term            = chip8_dap_term{ };
+
+            if ( !compile_term( group.substr( 0, and_split ), term ) )
+                return false;
+
+            condition.back( ).emplace_back( term );
+
+            group = and_split == std::string_view::npos ? std::string_view{ } : trim( group.substr( and_split + 2 ) );
+        }
+
+        if ( condition.back( ).empty( ) )
+            return false;
+
+        text = or_split == std::string_view::npos ? std::string_view{ } : trim( text.substr( or_split + 2 ) );
+    }
+
+    hit_text = trim( hit_text );
+
+    if ( hit_text.empty( ) )
+        return true;
+
+    static constexpr std::pair<std::string_view, echip8_dap_compares> Prefixes[ ] = {
+        { ">=", ecd_compare_ge }, { "==", ecd_compare_eq }, { ">", ecd_compare_gt }, { "%", ecd_compare_modulo }
+    };
+
+    hit_compare = ecd_compare_ge;
+
+    for ( const auto& [ prefix, compare ] : Prefixes ) {
+        if ( hit_text.rfind( prefix, 0 ) != 0 )
+            continue;
+
+        hit_compare = compare;
+        hit_text    = trim( hit_text.substr( prefix.size( ) ) );
+        break;
+    }
+
+    const auto hit_string = std::string{ hit_text };
+
+    auto* hit_end = (char*)nullptr;
+
+    hit_target = std::strtoull( hit_string.c_str( ), &hit_end, 10 );
+
+    if ( hit_string.empty( ) || hit_end != hit_string.c_str( ) + hit_string.size( ) )
+        return false;
+
+    has_hit_condition = hit_compare != ecd_compare_modulo || hit_target > 0;
+
+    return has_hit_condition;
+}
+
+echip8_dap_actions chip8_dap_breakpoint::hit( chip8& chip8_instance ) {
+    if ( !get_is_true( chip8_instance ) )
+        return ecd_action_skip;
+
+    hit_count += 1;
+
+    if ( has_hit_condition && !compare( hit_count, hit_compare, hit_target ) )
+        return ecd_action_skip;
+
+    return log_message.empty( ) ? ecd_action_stop : ecd_action_log;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_dap_breakpoint::compile_term( std::string_view text, chip8_dap_term& term ) {
+    // Two characters operators first so "<=" never match "<".
+    static constexpr std::pair<std::string_view, echip8_dap_compares> Operators[ ] = {
+        { "==", ecd_compare_eq }, { "!=", ecd_compare_ne }, { "<=", ecd_compare_le },
+        { ">=", ecd_compare_ge }, { "<", ecd_compare_lt }, { ">", ecd_compare_gt }
+    };
+
+    for ( const auto& [ symbol, compare ] : Operators ) {
+        const auto split = text.find( symbol );
+
+        if ( split == std::string_view::npos )
+            continue;
+
+        term.compare = compare;
+
+        return compile_operand( text.substr( 0, split ), term.left ) && compile_operand( text.substr( split + symbol.size( ) ), term.right );
+    }
+
+    // A lone operand is true when not zero.
+    term.compare = ecd_compare_ne;
+    term.right   = { ecd_operand_value, 0 };
+
+    return compile_operand( text, term.left );
+}
+
+bool chip8_dap_breakpoint::compile_operand( std::string_view text, chip8_dap_operand& operand ) {
+    static constexpr std::pair<std::string_view, echip8_dap_operands> Names[ ] = {
+        { "I", ecd_operand_index }, { "PC", ecd_operand_pc }, { "SP", ecd_operand_sp },
+        { "DT", ecd_operand_delay }, { "ST", ecd_operand_sound }
+    };
+
+    text = trim( text );
+
+    if ( text.empty( ) )
+        return false;
+
+    auto name = std::string{ text };
+
+    std::transform( name.begin( ), name.end( ), name.begin( ), [ ]( const char character ) -> char {
+        return char( std::toupper( uint8_t( character ) ) );
+    } );
+
+    for ( const auto& [ symbol, source ] : Names ) {
+        if ( name == symbol ) {
+            operand = { source, 0 };
+
+            return true;
+        }
+    }
+
+    if ( name.size( ) == 2 && name[ 0 ] == 'V' && std::isxdigit( uint8_t( name[ 1 ] ) ) ) {
+        operand = { ecd_operand_register, uint16_t( std::stoul( name.substr( 1 ), nullptr, 16 ) ) };
+
+        return true;
+    }
+
+    auto* name_end   = (char*)nullptr;
+    const auto value = std::strtoul( name.c_str( ), &name_end, 0 );
+
+    if ( name_end != name.c_str( ) + name.size( ) || value > 0xFFFF )
+        return false;
+
+    operand = { ecd_operand_value, uint16_t( value ) };
+
+    return true;
+}
+
+std::string_view chip8_dap_breakpoint::trim( std::string_view text ) {
+    const auto first = text.find_first_not_of( " \t" );
+
+    if ( first == std::string_view::npos )
+        return { };
+
+    return text.substr( first, text.find_last_not_of( " \t" ) - first + 1 );
+}
+
+bool chip8_dap_breakpoint::compare( const uint64_t left, const echip8_dap_compares compare, const uint64_t right ) {
+    switch ( compare ) {
+        case ecd_compare_eq     : return left == right;
+        case ecd_compare_ne     : return left != right;
+        case ecd_compare_lt     : return left < right;
+        case ecd_compare_le     : return left <= right;
+        case ecd_compare_gt     : return left > right;
+        case ecd_compare_ge     : return left >= right;
+        case ecd_compare_modulo : return right > 0 && left % right == 0;
+
+        default : break;
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::string chip8_dap_breakpoint::get_log( chip8& chip8_instance ) const {
+    auto text  = std::string{ };
+    auto value = std::array<char, 8>{ };
+    auto begin = size_t( 0 );
+
+    while ( begin < log_message.size( ) ) {
+        const auto open  = log_message.find( '{', begin );
+        const auto close = open == std::string::npos ? open : log_message.find( '}', open );
+
+        if ( close == std::string::npos ) {
+            text.append( log_message, begin );
+
+            break;
+        }
+
+        auto operand = chip8_dap_operand{ };
+
+        text.append( log_message, begin, open - begin );
+
+        // Unknown operands are kept as written.
+        if ( compile_operand( std::string_view{ log_message }.substr( open + 1, close - open - 1 ), operand ) ) {
+            snprintf( value.data( ), value.size( ), "0x%02X", get_value( chip8_instance, operand ) );
+
+            text += value.data( );
+        } else
+            text.append( log_message, open, close - open + 1 );
+
+        begin = close + 1;
+    }
+
+    return text + '\n';
+}
+
+bool chip8_dap_breakpoint::get_is_true( chip8& chip8_instance ) const {
+    auto is_true = condition.empty( );
+
+    for ( const auto& group : condition ) {
+        is_true = true;
+
+        for ( const auto& term : group ) {
+            const auto left  = get_value( chip8_instance, term.left );
+            const auto right = get_value( chip8_instance, term.right );
+
+            if ( !compare( left, term.compare, right ) ) {
+                is_true = false;
+                break;
+            }
+        }
+
+        if ( is_true )
+            break;
+    }
+
+    return is_true;
+}
+
+bool chip8_dap_breakpoint::get_is_logpoint( ) const {
+    return !log_message.empty( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint16_t chip8_dap_breakpoint::get_value( chip8& chip8_instance, const chip8_dap_operand& operand ) {
+    const auto& hot = chip8_instance.get_hot_state( );
+
+    switch ( operand.source ) {
+        case ecd_operand_value    : return operand.value;
+        case ecd_operand_register : return hot.V[ operand.value & 0xF ];
+        case ecd_operand_index    : return hot.I;
+        case ecd_operand_pc       : return uint16_t( hot.PC + eca_rom_start );
+        case ecd_operand_sp       : return chip8_instance.get_mmu( ).get_stack( ).get_depth( );
+        case ecd_operand_delay    : return hot.delay_timer;
+        case ecd_operand_sound    : return hot.sound_timer;
+
+        default : break;
+    }
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "chip8_dap_writer.h"
+
+/**
+ * Define all condition operand sources.
+ **/
+enum echip8_dap_operands : uint8_t {
+    ecd_operand_value = 0,
+    ecd_operand_register,
+    ecd_operand_index,
+    ecd_operand_pc,
+    ecd_operand_sp,
+    ecd_operand_delay,
+    ecd_operand_sound
+};
+
+/**
+ * Define all condition comparisons.
+ **/
+enum echip8_dap_compares : uint8_t {
+    ecd_compare_eq = 0,
+    ecd_compare_ne,
+    ecd_compare_lt,
+    ecd_compare_le,
+    ecd_compare_gt,
+    ecd_compare_ge,
+    ecd_compare_modulo
+};
+
+/**
+ * Define all breakpoint hit actions.
+ **/
+enum echip8_dap_actions : uint8_t {
+    ecd_action_skip = 0,
+    ecd_action_log,
+    ecd_action_stop
+};
+
+/**
+ * Define a condition operand.
+ * @field source : Operand source.
+ * @field value : Literal value or register index.
+ **/
+struct chip8_dap_operand {
+    echip8_dap_operands source;
+    uint16_t value;
+};
+
+/**
+ * Define a condition comparison.
+ * @field left : Left operand.
+ * @field compare : Comparison.
+ * @field right : Right operand.
+ **/
+struct chip8_dap_term {
+    chip8_dap_operand left;
+    echip8_dap_compares compare;
+    chip8_dap_operand right;
+};
+
+/**
+ * chip8_dap_breakpoint class
+ * @note Define a source breakpoint with an optional condition,
+ *       hit condition and log message. Conditions are compiled once
+ *       when set and only evaluated when the machine stops on the
+ *       breakpoint address.
+ *       Conditions compare V0-VF, I, PC, SP, DT, ST or literals with
+ *       == != < <= > >= joined by && and ||. Hit conditions are N or
+ *       >=N, ==N, >N and %N. Log messages replace {operand}.
+ **/
+class chip8_dap_breakpoint final {
+
+private:
+    std::vector<std::vector<chip8_dap_term>> condition;
+    echip8_dap_compares hit_compare;
+    uint64_t hit_target;
+    std::string log_message;
+    uint64_t hit_count;
+    bool has_hit_condition;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_dap_breakpoint( );
+
+    /**
+     * compile function
+     * @note Compile breakpoint condition, hit condition and log
+     *       message, empty strings for none.
+     * @param condition_text : Condition expression.
+     * @param hit_text : Hit condition.
+     * @param log_text : Log message.
+     * @return True when every part is valid.
+     **/
+    bool compile(
+        std::string_view condition_text,
+        std::string_view hit_text,
+        std::string_view log_text
+    );
+
+    /**
+     * hit function
+     * @note Evaluate a hit of the breakpoint address, hit count only
+     *       increase when the condition is true.
+     * @param chip8_instance : Target machine.
+     * @return Action to take.
+     **/
+    echip8_dap_actions hit( chip8& chip8_instance );
+
+private:
+    /**
+     * compile_term function
+     * @note Compile a single comparison.
+     * @param text : Term text.
+     * @param term : Compiled term.
+     * @return True when the term is valid.
+     **/
+    static bool compile_term( std::string_view text, chip8_dap_term& term );
+
+    /**
+     * compile_operand function
+     * @note Compile a single operand.
+     * @param text : Operand text.
+     * @param operand : Compiled operand.
+     * @return True when the operand is valid.
+     **/
+    static bool compile_operand( std::string_view text, chip8_dap_operand& operand );
+
+    /**
+     * trim function
+     * @note Remove spaces around text.
+     * @param text : Target text.
+     * @return Trimmed text.
+     **/
+    static std::string_view trim( std::string_view text );
+
+    /**
+     * compare function
+     * @note Apply a comparison.
+     * @param left : Left value.
+     * @param compare : Comparison.
+     * @param right : Right value.
+     * @return Comparison result.
+     **/
+    static bool compare( const uint64_t left, const echip8_dap_compares compare, const uint64_t right );
+
+public:
+    /**
+     * get_log function
+     * @note Get log message with operands replaced by their value.
+     * @param chip8_instance : Target machine.
+     * @return Log line.
+     **/
+    std::string get_log( chip8& chip8_instance ) const;
+
+    /**
+     * get_is_true function
+     * @note Get if the condition hold, hit count is left untouched.
+     * @param chip8_instance : Target machine.
+     * @return True when the condition hold or is empty.
+     **/
+    bool get_is_true( chip8& chip8_instance ) const;
+
+    /**
+     * get_is_logpoint function
+     * @note Get if the breakpoint only logs.
+     * @return True when a log message is set.
+     **/
+    bool get_is_logpoint( ) const;
+
+public:
+    /**
+     * get_value function
+     * @note Get current value of an operand.
+     * @param chip8_instance : Target machine.
+     * @param operand : Target operand.
+     * @return Operand value.
+     **/
+    static uint16_t get_value( chip8& chip8_instance, const chip8_dap_operand& operand );
+
+};
@@ -0,0 +1,100 @@
+#include "chip8_dap.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_dap_channel::chip8_dap_channel( )
+    : head{ 0 },
+    tail{ 0 },
+    signal{ 0 },
+    is_closed{ false },
+    messages{ },
+    dropped{ 0 }
+{ }
+
+bool chip8_dap_channel::push( std::string& message, const bool can_drop ) {
+    const auto tail_id = tail.load( std::memory_order_relaxed );
+
+    while ( tail_id - head.load( std::memory_order_acquire ) == Capacity ) {
+        const auto signal_id = signal.load( std::memory_order_acquire );
+
+        if ( can_drop ) {
+            dropped += 1;
+
+            return false;
+        }
+
+        if ( get_is_closed( ) )
+            return false;
+
+        // Recheck after loading the signal, a pop in between changed it.
+        if ( tail_id - head.load( std::memory_order_acquire ) == Capacity )
+            signal.wait( signal_id, std::memory_order_acquire );
+    }
+
+    std::swap( messages[ tail_id & Mask ], message );
+
+    tail.store( tail_id + 1, std::memory_order_release );
+
+    notify( );
+
+    return true;
+}
+
+bool chip8_dap_channel::pop( std::string& message ) {
+    const auto head_id = head.load( std::memory_order_relaxed );
+
+    if ( head_id == tail.load( std::memory_order_acquire ) )
+        return false;
+
+    std::swap( messages[ head_id & Mask ], message );
+
+    head.store( head_id + 1, std::memory_order_release );
+
+    notify( );
+
+    return true;
+}
+
+bool chip8_dap_channel::wait( ) {
+    while ( empty( ) ) {
+        const auto signal_id = signal.load( std::memory_order_acquire );
+
+        if ( get_is_closed( ) )
+            return !empty( );
+
+        if ( empty( ) )
+            signal.wait( signal_id, std::memory_order_acquire );
+    }
+
+    return true;
+}
+
+void chip8_dap_channel::close( ) {
+    is_closed.store( true, std::memory_order_release );
+
+    notify( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_dap_channel::notify( ) {
+    signal.fetch_add( 1, std::memory_order_release );
+    signal.notify_all( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_dap_channel::empty( ) const {
+    return head.load( std::memory_order_relaxed ) == tail.load( std::memory_order_acquire );
+}
+
+bool chip8_dap_channel::get_is_closed( ) const {
+    return is_closed.load( std::memory_order_acquire );
+}
+
+uint64_t chip8_dap_channel::get_dropped( ) const {
+    return dropped;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "chip8_dap_reader.h"
+
+/**
+ * chip8_dap_channel class
+ * @note Lock-free single producer single consumer ring of framed
+ *       messages between the emulation thread and an I/O thread.
+ *       Messages are swapped in and out of their slot, so buffers
+ *       are recycled instead of allocated once the ring is warm.
+ *       A signal counter let each side sleep on atomic wait while
+ *       the ring is empty, full or until it is closed.
+ **/
+class chip8_dap_channel final {
+
+public:
+    static constexpr uint32_t Capacity = 64;
+    static constexpr uint32_t Mask     = Capacity - 1;
+
+private:
+    alignas( 64 ) std::atomic<uint32_t> head;
+    alignas( 64 ) std::atomic<uint32_t> tail;
+    alignas( 64 ) std::atomic<uint32_t> signal;
+    std::atomic<bool> is_closed;
+    std::array<std::string, Capacity> messages;
+    uint64_t dropped;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_dap_channel( );
+
+    /**
+     * push function
+     * @note Swap a message into the ring, producer side only. When
+     *       the ring is full the message is dropped or the producer
+     *       wait for the consumer.
+     * @param message : Message to push, receive a recycled buffer.
+     * @param can_drop : True to drop the message on full ring.
+     * @return False when the message was dropped or channel closed.
+     **/
+    bool push( std::string& message, const bool can_drop );
+
+    /**
+     * pop function
+     * @note Swap oldest message out of the ring, consumer side only,
+     *       never block.
+     * @param message : Message output, its buffer is recycled.
+     * @return True when a message was popped.
+     **/
+    bool pop( std::string& message );
+
+    /**
+     * wait function
+     * @note Wait until a message is pending, consumer side only.
+     * @return False when the channel is closed and drained.
+     **/
+    bool wait( );
+
+    /**
+     * close method
+     * @note Close the channel and wake both sides.
+     **/
+    void close( );
+
+private:
+    /**
+     * notify method
+     * @note Wake the other side.
+     **/
+    void notify( );
+
+public:
+    /**
+     * empty function
+     * @note Get if no message is pending.
+     * @return True when no message is pending.
+     **/
+    bool empty( ) const;
+
+    /**
+     * get_is_closed function
+     * @note Get if the channel was closed.
+     * @return True when the channel was closed.
+     **/
+    bool get_is_closed( ) const;
+
+    /**
+     * get_dropped function
+     * @note Get message count dropped on full ring.
+     * @return Dropped message count.
+     **/
+    uint64_t get_dropped( ) const;
+
+};
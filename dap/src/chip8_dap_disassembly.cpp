@@ -0,0 +1,136 @@
+#include "chip8_dap.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_dap_disassembly::chip8_dap_disassembly( )
+    : texts( chip8_memory_manager_unit::Capacity ),
+    generations{ },
+    valid_pages{ 0 }
+{ }
+
+void chip8_dap_disassembly::invalidate( ) {
+    valid_pages = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_dap_disassembly::refresh( const chip8_memory_manager_unit& mmu, const uint16_t page_id ) {
+    const auto generation = mmu.get_generation( page_id );
+    const auto page_bit   = uint32_t( 1 ) << page_id;
+
+    if ( ( valid_pages & page_bit ) && generations[ page_id ] == generation )
+        return;
+
+    const auto* memory = mmu.get_memory( );
+    const auto first   = std::max( page_id * PageSize - 1, 0 );
+    const auto last    = std::min( ( page_id + 1 ) * PageSize, chip8_memory_manager_unit::Capacity - 1 );
+
+    for ( auto address = first; address < last; address++ )
+        decode( uint16_t( ( memory[ address ] << 8 ) | memory[ address + 1 ] ), texts[ address ] );
+
+    generations[ page_id ] = generation;
+    valid_pages           |= page_bit;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_dap_disassembly::decode( const uint16_t instruction, std::array<char, TextSize>& text ) {
+    static constexpr chip8_string Logics[ 16 ] = {
+        "LD", "OR", "AND", "XOR", "ADD", "SUB", "SHR", "SUBN",
+        nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, "SHL", nullptr
+    };
+
+    const auto x   = uint32_t( ( instruction >> 8 ) & 0xF );
+    const auto y   = uint32_t( ( instruction >> 4 ) & 0xF );
+    const auto n   = uint32_t( instruction & 0xF );
+    const auto nn  = uint32_t( instruction & 0xFF );
+    const auto nnn = uint32_t( instruction & 0xFFF );
+
+    // Jumps and calls target ROM offsets, shown as memory addresses.
+    const auto target = ( nnn + eca_rom_start ) & 0xFFF;
+
+    auto* data      = text.data( );
+    const auto size = text.size( );
+
+    switch ( instruction >> 12 ) {
+        case 0x0 :
+            // Same test order as the 0GGG routine.
+            if ( instruction & 0x0010 )
+                snprintf( data, size, "EXIT %u", n );
+            else if ( instruction == 0x00E0 )
+                snprintf( data, size, "CLS" );
+            else if ( instruction == 0x00EE )
+                snprintf( data, size, "RET" );
+            else
+                snprintf( data, size, "DW 0x%04X", instruction );
+            break;
+
+        case 0x1 : snprintf( data, size, "JP 0x%03X", target ); break;
+        case 0x2 : snprintf( data, size, "CALL 0x%03X", target ); break;
+        case 0x3 : snprintf( data, size, "SE V%X, 0x%02X", x, nn ); break;
+        case 0x4 : snprintf( data, size, "SNE V%X, 0x%02X", x, nn ); break;
+        case 0x6 : snprintf( data, size, "LD V%X, 0x%02X", x, nn ); break;
+        case 0x7 : snprintf( data, size, "ADD V%X, 0x%02X", x, nn ); break;
+        case 0xA : snprintf( data, size, "LD I, 0x%03X", nnn ); break;
+        case 0xB : snprintf( data, size, "JP V0, 0x%03X", target ); break;
+        case 0xC : snprintf( data, size, "RND V%X, 0x%02X", x, nn ); break;
+        case 0xD : snprintf( data, size, "DRW V%X, V%X, %u", x, y, n ); break;
+
+        case 0x5 :
+        case 0x9 :
+            if ( n == 0 )
+                snprintf( data, size, "%s V%X, V%X", ( instruction >> 12 ) == 0x5 ? "SE" : "SNE", x, y );
+            else
+                snprintf( data, size, "DW 0x%04X", instruction );
+            break;
+
+        case 0x8 :
+            if ( Logics[ n ] != nullptr )
+                snprintf( data, size, "%s V%X, V%X", Logics[ n ], x, y );
+            else
+                snprintf( data, size, "DW 0x%04X", instruction );
+            break;
+
+        case 0xE :
+            if ( nn == 0x9E )
+                snprintf( data, size, "SKP V%X", x );
+            else if ( nn == 0xA1 )
+                snprintf( data, size, "SKNP V%X", x );
+            else
+                snprintf( data, size, "DW 0x%04X", instruction );
+            break;
+
+        default :
+            switch ( nn ) {
+                case 0x07 : snprintf( data, size, "LD V%X, DT", x ); break;
+                case 0x0A : snprintf( data, size, "LD V%X, K", x ); break;
+                case 0x15 : snprintf( data, size, "LD DT, V%X", x ); break;
+                case 0x18 : snprintf( data, size, "LD ST, V%X", x ); break;
+                case 0x1E : snprintf( data, size, "ADD I, V%X", x ); break;
+                case 0x29 : snprintf( data, size, "LD F, V%X", x ); break;
+                case 0x33 : snprintf( data, size, "LD B, V%X", x ); break;
+                case 0x55 : snprintf( data, size, "LD [I], V%X", x ); break;
+                case 0x65 : snprintf( data, size, "LD V%X, [I]", x ); break;
+
+                default : snprintf( data, size, "DW 0x%04X", instruction ); break;
+            }
+            break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_string chip8_dap_disassembly::get( const chip8_memory_manager_unit& mmu, const uint16_t address ) {
+    if ( address + 1 >= chip8_memory_manager_unit::Capacity )
+        return "??";
+
+    // An instruction read its page and the next one.
+    refresh( mmu, address / PageSize );
+    refresh( mmu, ( address + 1 ) / PageSize );
+
+    return texts[ address ].data( );
+}
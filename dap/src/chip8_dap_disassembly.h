@@ -0,0 +1,66 @@
+#pragma once
+
+#include "chip8_dap_history.h"
+
+/**
+ * chip8_dap_disassembly class
+ * @note Cache the disassembly of every memory address. Each page is
+ *       decoded once and kept until the memory manager bump its
+ *       generation, so stepping only decode pages the program wrote
+ *       since the last request.
+ **/
+class chip8_dap_disassembly final {
+
+public:
+    static constexpr uint16_t TextSize  = 24;
+    static constexpr uint16_t PageSize  = chip8_memory_manager_unit::PageSize;
+    static constexpr uint16_t PageCount = chip8_memory_manager_unit::PageCount;
+
+private:
+    std::vector<std::array<char, TextSize>> texts;
+    std::array<uint32_t, PageCount> generations;
+    uint32_t valid_pages;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_dap_disassembly( );
+
+    /**
+     * invalidate method
+     * @note Drop every cached page.
+     **/
+    void invalidate( );
+
+private:
+    /**
+     * refresh method
+     * @note Decode a page again when its generation changed, the
+     *       address before the page read its first byte and is
+     *       decoded with it.
+     * @param mmu : Source memory.
+     * @param page_id : Target page.
+     **/
+    void refresh( const chip8_memory_manager_unit& mmu, const uint16_t page_id );
+
+    /**
+     * decode method
+     * @note Write instruction mnemonic, jump targets are shown as
+     *       memory addresses.
+     * @param instruction : Target instruction.
+     * @param text : Mnemonic output.
+     **/
+    static void decode( const uint16_t instruction, std::array<char, TextSize>& text );
+
+public:
+    /**
+     * get function
+     * @note Get the disassembly of an instruction.
+     * @param mmu : Source memory.
+     * @param address : Instruction memory address.
+     * @return Instruction mnemonic.
+     **/
+    chip8_string get( const chip8_memory_manager_unit& mmu, const uint16_t address );
+
+};
@@ -0,0 +1,79 @@
+#include "chip8_dap.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_dap_history::chip8_dap_history( )
+    : snapshots{ Capacity },
+    first{ 0 },
+    count{ 0 },
+    next_cycle{ 0 }
+{ }
+
+void chip8_dap_history::reset( chip8& chip8_instance ) {
+    first      = 0;
+    count      = 0;
+    next_cycle = chip8_instance.get_hot_state( ).cycles;
+
+    record( chip8_instance );
+}
+
+void chip8_dap_history::record( chip8& chip8_instance ) {
+    const auto cycle = chip8_instance.get_hot_state( ).cycles;
+
+    if ( cycle < next_cycle )
+        return;
+
+    // Once full the oldest snapshot is overwritten.
+    if ( count == Capacity )
+        first = ( first + 1 ) % Capacity;
+    else
+        count += 1;
+
+    chip8_instance.save_state( snapshots[ ( first + count - 1 ) % Capacity ] );
+
+    next_cycle = ( cycle / Interval + 1 ) * Interval;
+}
+
+bool chip8_dap_history::seek(
+    chip8& chip8_instance,
+    const uint64_t cycle,
+    const uint32_t instruction_per_second
+) {
+    if ( count == 0 || cycle < get_snapshot( 0 ).hot.cycles )
+        return false;
+
+    while ( cycle < get_snapshot( count - 1 ).hot.cycles )
+        count -= 1;
+
+    const auto& hot = chip8_instance.get_hot_state( );
+
+    chip8_instance.load_state( get_snapshot( count - 1 ) );
+
+    // Replayed instructions already ran once, stop anyway if one end the program.
+    while ( hot.cycles < cycle ) {
+        const auto state = chip8_instance.step( instruction_per_second );
+
+        if ( state != ecs_run && state != ecs_wfk )
+            break;
+    }
+
+    next_cycle = ( get_snapshot( count - 1 ).hot.cycles / Interval + 1 ) * Interval;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t chip8_dap_history::get_next_cycle( ) const {
+    return next_cycle;
+}
+
+uint32_t chip8_dap_history::get_count( ) const {
+    return count;
+}
+
+const chip8_machine_state& chip8_dap_history::get_snapshot( const uint32_t snapshot_id ) const {
+    return snapshots[ ( first + snapshot_id ) % Capacity ];
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "chip8_dap_breakpoint.h"
+
+/**
+ * chip8_dap_history class
+ * @note Store machine snapshots every Interval instructions in a
+ *       fixed ring, the oldest snapshot is dropped once full. Any
+ *       past instruction within the ring is reached by loading the
+ *       nearest older snapshot and replaying at most Interval
+ *       instructions, timers follow the instruction count so the
+ *       replay is deterministic.
+ **/
+class chip8_dap_history final {
+
+public:
+    static constexpr uint32_t Interval = 4096;
+    static constexpr uint32_t Capacity = 256;
+
+private:
+    std::vector<chip8_machine_state> snapshots;
+    uint32_t first;
+    uint32_t count;
+    uint64_t next_cycle;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_dap_history( );
+
+    /**
+     * reset method
+     * @note Clear history and snapshot current machine.
+     * @param chip8_instance : Target machine.
+     **/
+    void reset( chip8& chip8_instance );
+
+    /**
+     * record method
+     * @note Snapshot the machine once it reached the next interval.
+     * @param chip8_instance : Target machine.
+     **/
+    void record( chip8& chip8_instance );
+
+    /**
+     * seek function
+     * @note Bring the machine back to a past instruction count,
+     *       snapshots past it are dropped.
+     * @param chip8_instance : Target machine.
+     * @param cycle : Target instruction count.
+     * @param instruction_per_second : Target speed, for timers.
+     * @return False when cycle is older than the history.
+     **/
+    bool seek(
+        chip8& chip8_instance,
+        const uint64_t cycle,
+        const uint32_t instruction_per_second
+    );
+
+public:
+    /**
+     * get_next_cycle function
+     * @note Get instruction count of the next snapshot.
+     * @return Instruction count.
+     **/
+    uint64_t get_next_cycle( ) const;
+
+    /**
+     * get_count function
+     * @note Get snapshot count.
+     * @return Snapshot count.
+     **/
+    uint32_t get_count( ) const;
+
+    /**
+     * get_snapshot function
+     * @note Get a snapshot from the oldest.
+     * @param snapshot_id : Snapshot index, 0 for the oldest.
+     * @return Snapshot.
+     **/
+    const chip8_machine_state& get_snapshot( const uint32_t snapshot_id ) const;
+
+};
@@ -0,0 +1,132 @@
+#include "chip8_dap.h"
+
+#ifdef WINDOWS
+#   include <io.h>
+#   include <windows.h>
+#else
+#   include <poll.h>
+#   include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_dap_reader::chip8_dap_reader( )
+    : buffer( Capacity + simdjson::SIMDJSON_PADDING ),
+    begin{ 0 },
+    end{ 0 },
+    is_closed{ false }
+{ }
+
+std::string_view chip8_dap_reader::receive( ) {
+    static constexpr auto Separator = std::string_view{ "\r\n\r\n" };
+    static constexpr auto Length    = std::string_view{ "Content-Length:" };
+
+    while ( true ) {
+        const auto pending = std::string_view{ buffer.data( ) + begin, end - begin };
+        const auto split   = pending.find( Separator );
+
+        if ( split == std::string_view::npos ) {
+            if ( !fill( 0 ) )
+                return { };
+
+            continue;
+        }
+
+        const auto header = pending.substr( 0, split );
+        const auto field  = header.find( Length );
+
+        // Frame without length can't be skipped safely, drop headers.
+        if ( field == std::string_view::npos ) {
+            begin += split + Separator.size( );
+
+            continue;
+        }
+
+        const auto body_size    = size_t( std::strtoull( header.data( ) + field + Length.size( ), nullptr, 10 ) );
+        const auto message_size = split + Separator.size( ) + body_size;
+
+        if ( pending.size( ) < message_size ) {
+            if ( !fill( message_size ) )
+                return { };
+
+            continue;
+        }
+
+        const auto* body = buffer.data( ) + begin + split + Separator.size( );
+
+        begin += message_size;
+
+        return { body, body_size };
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_dap_reader::fill( const size_t message_size ) {
+    if ( is_closed )
+        return false;
+
+    const auto capacity = buffer.size( ) - simdjson::SIMDJSON_PADDING;
+
+    // Keep the pending message at the front so it can grow in place.
+    if ( begin > 0 ) {
+        std::memmove( buffer.data( ), buffer.data( ) + begin, end - begin );
+
+        end  -= begin;
+        begin = 0;
+    }
+
+    if ( message_size > capacity || end == capacity )
+        buffer.resize( std::max( message_size, capacity * 2 ) + simdjson::SIMDJSON_PADDING );
+
+    const auto free_size = buffer.size( ) - simdjson::SIMDJSON_PADDING - end;
+
+#ifdef WINDOWS
+    const auto read_size = _read( 0, buffer.data( ) + end, uint32_t( free_size ) );
+#else
+    const auto read_size = read( 0, buffer.data( ) + end, free_size );
+#endif
+
+    if ( read_size <= 0 ) {
+        is_closed = true;
+
+        return false;
+    }
+
+    end += size_t( read_size );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_dap_reader::get_has_input( const int32_t timeout ) const {
+    if ( begin < end || is_closed )
+        return true;
+
+#ifdef WINDOWS
+    // Pipes can't be waited on, peek every millisecond instead.
+    for ( auto elapsed = int32_t( 0 ); ; elapsed++ ) {
+        auto available = DWORD( 0 );
+
+        if ( !PeekNamedPipe( GetStdHandle( STD_INPUT_HANDLE ), nullptr, 0, nullptr, &available, nullptr ) || available > 0 )
+            return true;
+
+        if ( elapsed >= timeout )
+            return false;
+
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+#else
+    auto input_poll = pollfd{ 0, POLLIN, 0 };
+
+    return poll( &input_poll, 1, timeout ) > 0;
+#endif
+}
+
+bool chip8_dap_reader::get_is_closed( ) const {
+    return is_closed;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "chip8.h"
+
+#include "thirdparty/simdjson.h"
+
+/**
+ * chip8_dap_reader class
+ * @note Read Content-Length framed DAP messages from stdin into a
+ *       single reusable buffer. Message bodies are returned in place,
+ *       without any copy, and stay valid until the next receive.
+ **/
+class chip8_dap_reader final {
+
+public:
+    static constexpr size_t Capacity = 64 * 1024;
+
+private:
+    std::vector<char> buffer;
+    size_t begin;
+    size_t end;
+    bool is_closed;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_dap_reader( );
+
+    /**
+     * receive function
+     * @note Wait for the next message, the returned body stay valid
+     *       until the next receive.
+     * @return Message body, padded, empty when stdin was closed.
+     **/
+    std::string_view receive( );
+
+private:
+    /**
+     * fill function
+     * @note Read available bytes from stdin, compact and grow the
+     *       buffer when a message doesn't fit.
+     * @param message_size : Bytes needed from begin, 0 for unknown.
+     * @return False when stdin was closed.
+     **/
+    bool fill( const size_t message_size );
+
+public:
+    /**
+     * get_has_input function
+     * @note Get if a message is buffered or stdin has pending bytes,
+     *       wait up to timeout for bytes to arrive.
+     * @param timeout : Wait timeout in milliseconds, 0 never block.
+     * @return True when a message is arriving or stdin was closed.
+     **/
+    bool get_has_input( const int32_t timeout = 0 ) const;
+
+    /**
+     * get_is_closed function
+     * @note Get if stdin was closed.
+     * @return True when stdin was closed.
+     **/
+    bool get_is_closed( ) const;
+
+};
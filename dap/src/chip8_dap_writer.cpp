@@ -0,0 +1,214 @@
+#include "chip8_dap.h"
+
+#ifdef WINDOWS
+#   include <fcntl.h>
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_dap_writer::chip8_dap_writer( chip8_dap_channel& output_channel )
+    : channel{ output_channel },
+    buffer{ },
+    sequence{ 1 },
+    separators{ 0 },
+    depth{ 0 }
+{
+    buffer.reserve( Capacity );
+
+#ifdef WINDOWS
+    _setmode( 1, _O_BINARY );
+#endif
+}
+
+void chip8_dap_writer::begin_response(
+    const int64_t request_sequence,
+    std::string_view command,
+    const bool success
+) {
+    begin_message( "response" );
+
+    add_number( "request_seq", request_sequence );
+    add_bool( "success", success );
+    add_string( "command", command );
+}
+
+void chip8_dap_writer::begin_event( chip8_string event ) {
+    begin_message( "event" );
+
+    add_string( "event", event );
+}
+
+void chip8_dap_writer::begin_object( chip8_string name ) {
+    add_name( name );
+
+    buffer += '{';
+    depth  += 1;
+
+    separators &= ~( uint64_t( 1 ) << ( depth % MaxDepth ) );
+}
+
+void chip8_dap_writer::end_object( ) {
+    buffer += '}';
+    depth  -= 1;
+}
+
+void chip8_dap_writer::begin_array( chip8_string name ) {
+    add_name( name );
+
+    buffer += '[';
+    depth  += 1;
+
+    separators &= ~( uint64_t( 1 ) << ( depth % MaxDepth ) );
+}
+
+void chip8_dap_writer::end_array( ) {
+    buffer += ']';
+    depth  -= 1;
+}
+
+void chip8_dap_writer::add_string( chip8_string name, std::string_view value ) {
+    static constexpr chip8_string Digits = "0123456789abcdef";
+
+    add_name( name );
+
+    buffer += '"';
+
+    for ( const auto character : value ) {
+        switch ( character ) {
+            case '"'  : buffer += "\\\""; break;
+            case '\\' : buffer += "\\\\"; break;
+            case '\n' : buffer += "\\n"; break;
+            case '\r' : buffer += "\\r"; break;
+            case '\t' : buffer += "\\t"; break;
+
+            default :
+                if ( uint8_t( character ) < 0x20 ) {
+                    buffer += "\\u00";
+                    buffer += Digits[ uint8_t( character ) >> 4 ];
+                    buffer += Digits[ uint8_t( character ) & 0xF ];
+                } else
+                    buffer += character;
+                break;
+        }
+    }
+
+    buffer += '"';
+}
+
+void chip8_dap_writer::add_number( chip8_string name, const int64_t value ) {
+    auto text = std::array<char, 24>{ };
+
+    add_name( name );
+
+    const auto [ text_end, error ] = std::to_chars( text.data( ), text.data( ) + text.size( ), value );
+
+    buffer.append( text.data( ), text_end );
+}
+
+void chip8_dap_writer::add_bool( chip8_string name, const bool value ) {
+    add_name( name );
+
+    buffer += value ? "true" : "false";
+}
+
+void chip8_dap_writer::add_base64( chip8_string name, const uint8_t* data, const size_t size ) {
+    static constexpr chip8_string Digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    add_name( name );
+
+    buffer += '"';
+
+    for ( auto offset = size_t( 0 ); offset < size; offset += 3 ) {
+        const auto remaining = size - offset;
+        const auto group     = uint32_t( data[ offset ] << 16 )
+                             | uint32_t( remaining > 1 ? data[ offset + 1 ] << 8 : 0 )
+                             | uint32_t( remaining > 2 ? data[ offset + 2 ] : 0 );
+
+        buffer += Digits[ ( group >> 18 ) & 0x3F ];
+        buffer += Digits[ ( group >> 12 ) & 0x3F ];
+        buffer += remaining > 1 ? Digits[ ( group >> 6 ) & 0x3F ] : '=';
+        buffer += remaining > 2 ? Digits[ group & 0x3F ] : '=';
+    }
+
+    buffer += '"';
+}
+
+bool chip8_dap_writer::send( const bool can_drop ) {
+    end_object( );
+
+    auto header = std::array<char, HeaderSize>{ };
+
+    const auto body_size   = buffer.size( ) - HeaderSize;
+    const auto header_size = size_t( snprintf( header.data( ), header.size( ), "Content-Length: %zu\r\n\r\n", body_size ) );
+    const auto offset      = HeaderSize - header_size;
+
+    // Header is right aligned against the body, one write per message.
+    std::memcpy( buffer.data( ) + offset, header.data( ), header_size );
+
+    return channel.push( buffer, can_drop );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_dap_writer::begin_message( chip8_string type ) {
+    buffer.assign( HeaderSize, ' ' );
+
+    separators = 0;
+    depth      = 0;
+
+    begin_object( nullptr );
+
+    add_number( "seq", sequence++ );
+    add_string( "type", type );
+}
+
+void chip8_dap_writer::add_name( chip8_string name ) {
+    const auto bit = uint64_t( 1 ) << ( depth % MaxDepth );
+
+    if ( separators & bit )
+        buffer += ',';
+
+    separators |= bit;
+
+    if ( name == nullptr )
+        return;
+
+    buffer += '"';
+    buffer += name;
+    buffer += "\":";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_dap_writer::write( const std::string& message ) {
+    // Skip the unused part of the header room.
+    const auto offset = message.find_first_not_of( ' ' );
+
+    if ( offset == std::string::npos )
+        return true;
+
+    const auto* data = message.data( ) + offset;
+    auto size        = message.size( ) - offset;
+
+    while ( size > 0 ) {
+#ifdef WINDOWS
+        const auto written = _write( 1, data, uint32_t( size ) );
+#else
+        const auto written = ::write( 1, data, size );
+#endif
+
+        if ( written <= 0 )
+            return false;
+
+        data += written;
+        size -= size_t( written );
+    }
+
+    return true;
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "chip8_dap_channel.h"
+
+#include <charconv>
+
+/**
+ * chip8_dap_writer class
+ * @note Serialize DAP responses and events into a preallocated
+ *       buffer and post each message with its Content-Length header
+ *       to a channel, the I/O thread write it in a single call. Room
+ *       for the header is reserved in front of the body, so nothing
+ *       is copied once serialized.
+ **/
+class chip8_dap_writer final {
+
+public:
+    static constexpr size_t Capacity   = 64 * 1024;
+    static constexpr size_t HeaderSize = 32;
+    static constexpr uint32_t MaxDepth = 64;
+
+private:
+    chip8_dap_channel& channel;
+    std::string buffer;
+    int64_t sequence;
+    uint64_t separators;
+    uint32_t depth;
+
+public:
+    /**
+     * Constructor
+     * @param output_channel : Channel to the output thread.
+     **/
+    chip8_dap_writer( chip8_dap_channel& output_channel );
+
+    /**
+     * begin_response method
+     * @note Start a response message, the message object stay open.
+     * @param request_sequence : Request sequence number.
+     * @param command : Request command name.
+     * @param success : True when the request succeeded.
+     **/
+    void begin_response(
+        const int64_t request_sequence,
+        std::string_view command,
+        const bool success
+    );
+
+    /**
+     * begin_event method
+     * @note Start an event message, the message object stay open.
+     * @param event : Event name.
+     **/
+    void begin_event( chip8_string event );
+
+    /**
+     * begin_object method
+     * @note Open an object.
+     * @param name : Member name, nullptr inside an array.
+     **/
+    void begin_object( chip8_string name );
+
+    /**
+     * end_object method
+     * @note Close current object.
+     **/
+    void end_object( );
+
+    /**
+     * begin_array method
+     * @note Open an array.
+     * @param name : Member name, nullptr inside an array.
+     **/
+    void begin_array( chip8_string name );
+
+    /**
+     * end_array method
+     * @note Close current array.
+     **/
+    void end_array( );
+
+    /**
+     * add_string method
+     * @note Add an escaped string value.
+     * @param name : Member name, nullptr inside an array.
+     * @param value : String value.
+     **/
+    void add_string( chip8_string name, std::string_view value );
+
+    /**
+     * add_number method
+     * @note Add an integer value.
+     * @param name : Member name, nullptr inside an array.
+     * @param value : Integer value.
+     **/
+    void add_number( chip8_string name, const int64_t value );
+
+    /**
+     * add_bool method
+     * @note Add a boolean value.
+     * @param name : Member name, nullptr inside an array.
+     * @param value : Boolean value.
+     **/
+    void add_bool( chip8_string name, const bool value );
+
+    /**
+     * add_base64 method
+     * @note Add bytes as a base64 string, encoded straight from the
+     *       source into the message.
+     * @param name : Member name, nullptr inside an array.
+     * @param data : Source bytes.
+     * @param size : Source byte count.
+     **/
+    void add_base64( chip8_string name, const uint8_t* data, const size_t size );
+
+    /**
+     * send function
+     * @note Close the message and post it to the output channel.
+     * @param can_drop : True to drop the message when the output
+     *                   thread is late instead of waiting.
+     * @return False when the message was dropped or stdout closed.
+     **/
+    bool send( const bool can_drop = false );
+
+private:
+    /**
+     * begin_message method
+     * @note Reset the buffer and open a message object.
+     * @param type : Message type.
+     **/
+    void begin_message( chip8_string type );
+
+    /**
+     * add_name method
+     * @note Add separator and member name.
+     * @param name : Member name, nullptr inside an array.
+     **/
+    void add_name( chip8_string name );
+
+public:
+    /**
+     * write function
+     * @note Write a posted message to stdout.
+     * @param message : Target message.
+     * @return False when stdout was closed.
+     **/
+    static bool write( const std::string& message );
+
+};
@@ -0,0 +1,127 @@
+#include "chip8_decoder.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_decoder::chip8_decoder( )
+    : trace_file{ },
+    records{ nullptr },
+    record_count{ 0 },
+    use_all{ false }
+{ }
+
+void chip8_decoder::parse_option( chip8_string argument ) {
+    switch ( argument[ 1 ] ) {
+        case 'a' :
+        case 'A' :
+            use_all = true;
+            break;
+
+        default : break;
+    }
+}
+
+bool chip8_decoder::open( chip8_string trace_path ) {
+    if ( !trace_file.open( trace_path ) )
+        return false;
+
+    records = chip8_trace_recorder::validate( trace_file.get_data( ), trace_file.get_size( ) );
+
+    if ( !records )
+        return false;
+
+    record_count = ( trace_file.get_size( ) - sizeof( chip8_trace_header ) ) / sizeof( chip8_trace_record );
+
+    return true;
+}
+
+void chip8_decoder::print( ) const {
+    auto gap_count = uint64_t( 0 );
+    auto dropped   = uint64_t( 0 );
+
+    for ( auto record_id = uint64_t( 0 ); record_id < record_count; record_id++ ) {
+        const auto& record = records[ record_id ];
+
+        if ( record.register_id != chip8_trace_recorder::Gap ) {
+            print_record( record );
+
+            continue;
+        }
+
+        printf( "> Gap : %" PRIu64 " records dropped\n", record.cycle );
+
+        gap_count += 1;
+        dropped   += record.cycle;
+    }
+
+    if ( gap_count > 0 )
+        printf( "> Incomplete trace : %" PRIu64 " records dropped in %" PRIu64 " gaps\n", dropped, gap_count );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_decoder::print_record( const chip8_trace_record& record ) const {
+    const auto instruction = record.instruction;
+    const auto opcode      = uint8_t( instruction >> 12 );
+
+    auto x = uint16_t( ( instruction & 0x0F00 ) >> 8 );
+    auto y = uint16_t( ( instruction & 0x00F0 ) >> 4 );
+    auto n = uint16_t( instruction & 0x000F );
+
+    switch ( chip8_trace_recorder::get_format( opcode ) ) {
+        case ecf_xnn :
+            y = instruction & 0x00FF;
+            n = 0x0000;
+            break;
+
+        case ecf_nnn :
+            x = instruction & 0x0FFF;
+            y = 0x0000;
+            n = 0x0000;
+            break;
+
+        default : break;
+    }
+
+    printf( "%04X | 0x%X 0x%03X 0x%03X 0x%03X |", record.PC, opcode, x, y, n );
+
+    if ( use_all ) {
+        printf( " %10" PRIu64 " | I 0x%03X |", record.cycle, record.I );
+
+        if ( record.register_id != chip8_trace_recorder::Unchanged )
+            printf( " V%X 0x%02X", record.register_id, record.value );
+    }
+
+    printf( "\n" );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+int chip8_decoder::run( int argc, char** argv ) {
+    if ( argc < 2 ) {
+        printf( "> Usage : chip8_decoder <trace> [-a]\n" );
+
+        return -1;
+    }
+
+    auto decoder = chip8_decoder{ };
+
+    for ( auto arg_id = 2; arg_id < argc; arg_id++ ) {
+        const auto* argument = argv[ arg_id ];
+
+        if ( argument[ 0 ] == '-' )
+            decoder.parse_option( argument );
+    }
+
+    if ( !decoder.open( argv[ 1 ] ) ) {
+        printf( "> Invalid trace : %s\n", argv[ 1 ] );
+
+        return -1;
+    }
+
+    decoder.print( );
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "chip8.h"
+
+/**
+ * chip8_decoder class
+ * @note Command line binary trace decoder, print records with the
+ *       same columns as the text trace and report gaps left by
+ *       dropped records.
+ **/
+class chip8_decoder final {
+
+private:
+    chip8_mapped_file trace_file;
+    const chip8_trace_record* records;
+    uint64_t record_count;
+    bool use_all;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_decoder( );
+
+    /**
+     * parse_option method
+     * @note Parse decoder option.
+     * @param argument : Target argument to parse.
+     **/
+    void parse_option( chip8_string argument );
+
+    /**
+     * open function
+     * @note Map and validate a trace file.
+     * @param trace_path : Target trace file path.
+     * @return True when the trace is valid.
+     **/
+    bool open( chip8_string trace_path );
+
+    /**
+     * print method
+     * @note Print every record, each gap and the dropped record
+     *       total.
+     **/
+    void print( ) const;
+
+private:
+    /**
+     * print_record method
+     * @note Print a record as a text trace line.
+     * @param record : Target record.
+     **/
+    void print_record( const chip8_trace_record& record ) const;
+
+public:
+    /**
+     * run function
+     * @note Run the decoder.
+     * @param argc : Target input argument count.
+     * @param argv : Target input argument value.
+     * @return Return execution state.
+     **/
+    static int run( int argc, char** argv );
+
+};
@@ -0,0 +1,5 @@
+#include "chip8_decoder.h"
+
+int main( int argc, char** argv ) {
+    return chip8_decoder::run( argc, argv );
+}
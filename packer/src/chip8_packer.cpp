@@ -0,0 +1,112 @@
+#include "chip8_packer.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_packer::chip8_packer( )
+    : bundle{ },
+    quirks{ ecq_none },
+    instruction_per_second{ 0 },
+    rejected{ 0 }
+{ }
+
+void chip8_packer::parse_option( chip8_string argument ) {
+    switch ( argument[ 1 ] ) {
+        case 'i' :
+        case 'I' :
+            instruction_per_second = uint32_t( std::strtoul( argument + 2, nullptr, 10 ) );
+            break;
+
+        case 'l' :
+        case 'L' :
+            quirks |= ecq_legacy_set;
+
+            if ( argument[ 2 ] != '0' )
+                quirks |= ecq_legacy_on;
+            else
+                quirks &= ~ecq_legacy_on;
+            break;
+
+        case 's' :
+        case 'S' :
+            quirks |= ecq_stack_set;
+
+            if ( argument[ 2 ] != '0' )
+                quirks |= ecq_stack_limit;
+            else
+                quirks &= ~ecq_stack_limit;
+            break;
+
+        case 'r' :
+        case 'R' :
+            quirks                 = ecq_none;
+            instruction_per_second = 0;
+            break;
+
+        default : break;
+    }
+}
+
+void chip8_packer::add( chip8_string input_path ) {
+    auto error = std::error_code{ };
+
+    if ( !std::filesystem::is_directory( input_path, error ) ) {
+        add_file( input_path );
+
+        return;
+    }
+
+    auto rom_paths = std::vector<std::string>{ };
+
+    for ( const auto& item : std::filesystem::directory_iterator( input_path, error ) ) {
+        if ( item.is_regular_file( error ) )
+            rom_paths.emplace_back( item.path( ).string( ) );
+    }
+
+    std::sort( rom_paths.begin( ), rom_paths.end( ) );
+
+    for ( const auto& rom_path : rom_paths )
+        add_file( rom_path.c_str( ) );
+}
+
+bool chip8_packer::write( chip8_string bundle_path ) const {
+    printf( "> Packed %u ROM, %u rejected : %s\n", bundle.get_count( ), rejected, bundle_path );
+
+    return bundle.write( bundle_path );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_packer::add_file( chip8_string rom_path ) {
+    if ( bundle.add( rom_path, quirks, instruction_per_second ) )
+        return;
+
+    printf( "> Rejected ROM : %s\n", rom_path );
+
+    rejected += 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+int chip8_packer::run( int argc, char** argv ) {
+    if ( argc < 3 ) {
+        printf( "> Usage : chip8_packer <bundle> [-l0|-l1] [-s0|-s1] [-iN] [-r] <rom|directory>...\n" );
+
+        return -1;
+    }
+
+    auto packer = chip8_packer{ };
+
+    for ( auto arg_id = 2; arg_id < argc; arg_id++ ) {
+        const auto* argument = argv[ arg_id ];
+
+        if ( argument[ 0 ] == '-' )
+            packer.parse_option( argument );
+        else
+            packer.add( argument );
+    }
+
+    return packer.write( argv[ 1 ] ) ? 0 : -1;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "chip8.h"
+
+/**
+ * chip8_packer class
+ * @note Command line ROM bundle packer. Quirk options apply to
+ *       every ROM that follow them on the command line.
+ **/
+class chip8_packer final {
+
+private:
+    chip8_rom_bundle bundle;
+    uint8_t quirks;
+    uint32_t instruction_per_second;
+    uint32_t rejected;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_packer( );
+
+    /**
+     * parse_option method
+     * @note Parse quirk option.
+     * @param argument : Target argument to parse.
+     **/
+    void parse_option( chip8_string argument );
+
+    /**
+     * add method
+     * @note Add a ROM file or every ROM of a directory.
+     * @param input_path : Target ROM file or directory path.
+     **/
+    void add( chip8_string input_path );
+
+    /**
+     * write function
+     * @note Write the bundle file.
+     * @param bundle_path : Target bundle file path.
+     * @return True when the bundle was written.
+     **/
+    bool write( chip8_string bundle_path ) const;
+
+private:
+    /**
+     * add_file method
+     * @note Add a ROM file with current quirks.
+     * @param rom_path : Target ROM file path.
+     **/
+    void add_file( chip8_string rom_path );
+
+public:
+    /**
+     * run function
+     * @note Run the packer.
+     * @param argc : Target input argument count.
+     * @param argv : Target input argument value.
+     * @return Return execution state.
+     **/
+    static int run( int argc, char** argv );
+
+};
@@ -0,0 +1,5 @@
+#include "chip8_packer.h"
+
+int main( int argc, char** argv ) {
+    return chip8_packer::run( argc, argv );
+}
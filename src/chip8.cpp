@@ -12,16 +12,33 @@ chip8::chip8(
     const bool enable_print,
     const bool enable_stack_limit
 )
-    : mmu{ },
+    : hot{ },
+    mmu{ hot },
     smu{ },
-    cpu{ legacy_mode, enable_print, enable_stack_limit },
-    rom{ }
+    cpu{ hot, legacy_mode, enable_print, enable_stack_limit },
+    rom{ },
+    pacer{ },
+    input{ },
+    movie{ },
+    profiler{ },
+    trace{ },
+    event_batch{ },
+    metrics{ cpu.timers },
+    movie_mode{ ecmv_none },
+    instruction_limit{ UINT64_MAX },
+    bundles{ },
+    breakpoints{ },
+    breakpoint_count{ 0 },
+    is_interrupted{ false },
+    user_flags{ hot.flags }
 {
     reset_opcodes( );
     reset_get_key( );
 }
 
 void chip8::reset( ) {
+    auto reset_scope = chip8_event_scope{ "reset", "host", hot.cycles };
+
     mmu.reset( );
     smu.clear( );
     cpu.reset( );
@@ -85,11 +102,61 @@ void chip8::set_sound_timer( const uint8_t value ) {
     cpu.set_sound_timer( value );
 }
 
+void chip8::set_random_seed( const uint64_t seed ) {
+    cpu.set_random_seed( seed );
+}
+
+void chip8::set_random_mode( const echip8_random_modes mode ) {
+    cpu.set_random_mode( mode );
+}
+
+void chip8::set_instruction_limit( const uint64_t limit ) {
+    instruction_limit = limit;
+}
+
+void chip8::set_breakpoint( const uint16_t cpu_pc, const bool is_set ) {
+    const auto bit_id = uint16_t( cpu_pc & ( chip8_memory_manager_unit::Capacity - 1 ) );
+
+    if ( get_breakpoint( bit_id ) == is_set )
+        return;
+
+    breakpoints[ bit_id ] = is_set;
+
+    breakpoint_count = is_set ? breakpoint_count + 1 : breakpoint_count - 1;
+}
+
+void chip8::clear_breakpoints( ) {
+    breakpoints      = { };
+    breakpoint_count = 0;
+}
+
+void chip8::interrupt( ) {
+    is_interrupted.store( true, std::memory_order_release );
+}
+
+bool chip8::start_trace( chip8_string trace_path ) {
+    if ( !trace.start( trace_path ) )
+        return false;
+
+    cpu.set_trace( &trace );
+
+    return true;
+}
+
+void chip8::stop_trace( ) {
+    cpu.set_trace( nullptr );
+    trace.stop( );
+}
+
 void chip8::set_option(
     const echip8_cpu_options option,
     const bool value
 ) {
+    const auto option_bit = uint8_t( 1 << option );
+
     cpu.set_option( option, value );
+
+    user_flags = value ? user_flags | option_bit : user_flags & ~option_bit;
 }
 
 std::vector<chip8_string> chip8::parse_arguments(
@@ -103,60 +170,453 @@ std::vector<chip8_string> chip8::parse_arguments(
 
         if ( argument[ 0 ] == '-' )
             parse_option( argument );
-        else if ( std::filesystem::is_regular_file( argument ) )
-            rom_list.emplace_back( argument );
+        else if ( std::filesystem::is_regular_file( argument ) ) {
+            auto bundle = chip8_rom_library{ };
+
+            if ( !bundle.open( argument ) || !bundle.is_bundle( ) ) {
+                rom_list.emplace_back( argument );
+
+                continue;
+            }
+
+            for ( auto rom_id = uint32_t( 0 ); rom_id < bundle.get_count( ); rom_id++ )
+                rom_list.emplace_back( bundle.get( rom_id ).name );
+
+            bundles.emplace_back( std::move( bundle ) );
+        }
     }
 
     return rom_list;
 }
 
 bool chip8::load_rom( chip8_string rom_path ) {
+    auto load_scope = chip8_event_scope{ "load_rom", "host", hot.cycles };
+
+    for ( const auto& bundle : bundles ) {
+        const auto [ is_valid, entry ] = bundle.find( rom_path );
+
+        if ( is_valid )
+            return load_rom( entry );
+    }
+
+    apply_quirks( ecq_none );
+
     return rom.load( mmu, rom_path );
 }
 
+bool chip8::load_rom(
+    const chip8_rom_library& library,
+    const uint64_t rom_hash
+) {
+    auto load_scope = chip8_event_scope{ "load_rom", "host", hot.cycles };
+
+    const auto [ is_valid, entry ] = library.find( rom_hash );
+
+    if ( !is_valid )
+        return false;
+
+    return load_rom( entry );
+}
+
 echip8_states chip8::execute( const uint32_t instruction_per_second ) {
     if ( !rom.exist( ) )
         return ecs_nip;
 
     const auto* rom_path = rom.get_path( );
-    const auto rom_size  = rom.get_size( );
 
     printf( "> Executing ROM : %s\n", rom_path );
 
-    auto instruction_count = 0;
-    auto timer_manager     = echip8_timer_manager{ cpu };
-    auto cycle_start       = clock_t::now( );
-    auto state             = ecs_run;
-
     reset( );
 
-    while ( cpu.PC < rom_size && state == ecs_run ) {
-        const auto instruction = rom.fetch( mmu, cpu.PC );
+    return resume( instruction_per_second );
+}
 
-        state = cpu.execute( instruction, mmu, smu );
+echip8_states chip8::resume( const uint32_t instruction_per_second ) {
+    if ( !rom.exist( ) )
+        return ecs_nip;
+
+    const auto rom_size  = rom.get_size( );
+    const auto rom_speed = rom.get_instruction_per_second( );
+    const auto speed     = rom_speed > 0 ? rom_speed : instruction_per_second;
+
+    const auto use_service = !cpu.get_option( ecc_option_virtual );
+    const auto use_limit   = cpu.get_option( ecc_option_limit ) && speed > 0;
+    const auto use_vblank  = cpu.get_option( ecc_option_vblank );
+    const auto use_profile = profiler.is_enabled( );
+    const auto use_events  = chip8_event_trace::get( ).is_enabled( );
+    const auto use_breaks  = breakpoint_count > 0;
+    const auto use_bounded = instruction_limit < UINT64_MAX;
+
+    // Skipped iterations never execute, instrumentation must see them.
+    const auto use_idle = cpu.get_option( ecc_option_idle ) && !use_profile && !trace.is_enabled( ) && !chip8_cpu_opcode_manager::HasStats;
+    const auto tick_period = std::max( speed / 60, uint32_t( 1 ) );
+
+    // Timers tick on instruction count multiples, like step.
+    auto next_tick     = ( hot.cycles / tick_period + 1 ) * tick_period;
+    auto next_frame    = next_tick;
+    auto timer_manager = echip8_timer_manager{ cpu, use_service };
+    auto state         = ecs_run;
+    auto is_waiting    = false;
+
+    // A full timer service fall back to timers ticked by instruction count.
+    const auto use_virtual = !timer_manager.get_is_attached( );
+
+    pacer.start( speed );
+
+    if ( use_events )
+        begin_events( );
+
+    while ( cpu.state.PC < rom_size && state == ecs_run ) {
+        drain_input( );
+
+        const auto instruction = rom.fetch( mmu, cpu.state.PC );
+        const auto idle_loop   = use_idle ? detect_idle_loop( instruction ) : ecl_loop_none;
+
+        if ( use_profile )
+            profiler.tick( mmu, cpu.state.PC );
+
+        if ( use_events )
+            trace_events( instruction, tick_period );
+
+        if ( idle_loop != ecl_loop_none )
+            state = skip_idle_loop( idle_loop, instruction, use_virtual, next_tick );
+        else
+            state = cpu.execute( instruction, mmu, smu );
+
+        if ( state == ecs_wfk && !is_waiting )
+            metrics.add_key_wait( );
+
+        is_waiting = state == ecs_wfk;
+
+        if ( state == ecs_wfk ) {
+            if ( movie_mode == ecmv_play && movie.is_finished( ) )
+                break;
+
+            // Bounded runs spin on key waits, so the limit stays reachable.
+            if ( movie_mode != ecmv_play && !use_bounded ) {
+                pacer.wait( );
+
+                cpu.timers.get_audio( ).write_wav( );
+            }
+
+            state = ecs_run;
+        }
+
+        if ( use_virtual && next_tick <= hot.cycles ) {
+            cpu.update_timers( );
+
+            next_tick += tick_period;
+        }
+
+        if ( next_frame <= hot.cycles ) {
+            auto frame_count = uint64_t( 0 );
+
+            for ( ; next_frame <= hot.cycles; next_frame += tick_period )
+                frame_count += 1;
+
+            publish_metrics( frame_count );
+        }
+
+        const auto is_vblank = use_vblank && ( instruction & 0xF000 ) == 0xD000;
+
+        if ( use_limit && ( pacer.consume( ) || is_vblank ) )
+            pacer.wait( );
+
+        // Breakpoints first, next resume never test the instruction it start on.
+        if ( use_breaks && state == ecs_run && get_breakpoint( cpu.state.PC ) )
+            state = ecs_brk;
+
+        if ( state == ecs_run && instruction_limit <= hot.cycles )
+            state = ecs_ilr;
 
-        if ( cpu.get_option( ecc_option_limit ) && instruction_per_second > 0 )
-            try_wait( instruction_per_second, instruction_count, cycle_start );
+        // Another thread asked for control, end like a reached limit.
+        if ( state == ecs_run && is_interrupted.load( std::memory_order_relaxed ) && is_interrupted.exchange( false, std::memory_order_acquire ) )
+            state = ecs_ilr;
     }
 
     timer_manager.terminate( );
 
-    if ( state == ecs_run && rom_size <= cpu.PC )
+    if ( use_events )
+        end_events( );
+
+    if ( state == ecs_run && rom_size <= cpu.state.PC )
+        state = ecs_eop;
+
+    publish_metrics( 0 );
+
+    metrics.add_exit( state );
+
+    return state;
+}
+
+chip8_execution chip8::run( const uint32_t instruction_per_second ) {
+    if ( !rom.exist( ) )
+        co_return ecs_nip;
+
+    const auto rom_size  = rom.get_size( );
+    const auto rom_speed = rom.get_instruction_per_second( );
+    const auto speed     = rom_speed > 0 ? rom_speed : instruction_per_second;
+
+    const auto use_vblank   = cpu.get_option( ecc_option_vblank );
+    const auto use_profile  = profiler.is_enabled( );
+    const auto use_events   = chip8_event_trace::get( ).is_enabled( );
+    const auto use_breaks   = breakpoint_count > 0;
+    const auto frame_budget = std::max( speed / 60, uint32_t( 1 ) );
+
+    // Skipped iterations never execute, instrumentation must see them.
+    const auto use_idle = cpu.get_option( ecc_option_idle ) && !use_profile && !trace.is_enabled( ) && !chip8_cpu_opcode_manager::HasStats;
+
+    auto budget    = frame_budget;
+    auto state     = ecs_run;
+    auto key_scope = chip8_key_scope{ cpu, chip8_cpu_implementation::exec_get_key_latch };
+
+    if ( use_events )
+        begin_events( );
+
+    while ( cpu.state.PC < rom_size && state == ecs_run ) {
+        drain_input( );
+
+        const auto instruction = rom.fetch( mmu, cpu.state.PC );
+        const auto idle_loop   = use_idle ? detect_idle_loop( instruction ) : ecl_loop_none;
+
+        if ( use_profile )
+            profiler.tick( mmu, cpu.state.PC );
+
+        if ( use_events )
+            trace_events( instruction, frame_budget );
+
+        if ( idle_loop != ecl_loop_none ) {
+            while ( get_idle_remaining( idle_loop ) > 0 ) {
+                publish_metrics( 1 );
+
+                co_yield ecsp_frame;
+
+                cpu.update_timers( );
+            }
+
+            budget = frame_budget;
+            state  = exit_idle_loop( idle_loop, instruction );
+
+            continue;
+        }
+
+        state = cpu.execute( instruction, mmu, smu );
+
+        if ( state == ecs_wfk ) {
+            metrics.add_key_wait( );
+
+            co_yield ecsp_key;
+
+            drain_input( );
+
+            // Resumed without key, the host gave a frame tick.
+            if ( cpu.state.key_latch == eci_key_undefined ) {
+                publish_metrics( 1 );
+
+                cpu.update_timers( );
+
+                budget = frame_budget;
+            }
+
+            state = ecs_run;
+
+            continue;
+        }
+
+        const auto is_vblank = use_vblank && ( instruction & 0xF000 ) == 0xD000;
+
+        if ( --budget == 0 || is_vblank ) {
+            publish_metrics( 1 );
+
+            co_yield ecsp_frame;
+
+            cpu.update_timers( );
+
+            budget = frame_budget;
+        }
+
+        // Breakpoints first, next resume never test the instruction it start on.
+        if ( use_breaks && state == ecs_run && get_breakpoint( cpu.state.PC ) )
+            state = ecs_brk;
+
+        if ( state == ecs_run && instruction_limit <= hot.cycles )
+            state = ecs_ilr;
+
+        // Another thread asked for control, end like a reached limit.
+        if ( state == ecs_run && is_interrupted.load( std::memory_order_relaxed ) && is_interrupted.exchange( false, std::memory_order_acquire ) )
+            state = ecs_ilr;
+    }
+
+    if ( use_events )
+        end_events( );
+
+    if ( state == ecs_run && rom_size <= cpu.state.PC )
+        state = ecs_eop;
+
+    publish_metrics( 0 );
+
+    metrics.add_exit( state );
+
+    co_return state;
+}
+
+echip8_states chip8::step( const uint32_t instruction_per_second ) {
+    if ( !rom.exist( ) )
+        return ecs_nip;
+
+    const auto rom_size = rom.get_size( );
+
+    if ( rom_size <= cpu.state.PC )
+        return ecs_eop;
+
+    const auto rom_speed   = rom.get_instruction_per_second( );
+    const auto speed       = rom_speed > 0 ? rom_speed : instruction_per_second;
+    const auto tick_period = std::max( speed / 60, uint32_t( 1 ) );
+
+    drain_input( );
+
+    const auto instruction = rom.fetch( mmu, cpu.state.PC );
+
+    auto state = cpu.execute( instruction, mmu, smu );
+
+    if ( hot.cycles % tick_period == 0 ) {
+        cpu.update_timers( );
+
+        cpu.timers.get_audio( ).write_wav( );
+    }
+
+    if ( state == ecs_run && rom_size <= cpu.state.PC )
         state = ecs_eop;
 
     return state;
 }
 
+bool chip8::press_key( const echip8_input_keys key ) {
+    if ( !cpu.validate_key( key ) )
+        return false;
+
+    return input.push( key, true );
+}
+
+bool chip8::release_key( const echip8_input_keys key ) {
+    if ( !cpu.validate_key( key ) )
+        return false;
+
+    return input.push( key, false );
+}
+
 echip8_states chip8::execute( 
     chip8_string rom_path,
     const uint32_t instruction_per_second
 ) {
-    if ( !rom.load( mmu, rom_path ) )
+    if ( !load_rom( rom_path ) )
         return ecs_iir;
     
     return execute( instruction_per_second );
 }
 
+echip8_states chip8::execute(
+    const chip8_rom_library& library,
+    const uint64_t rom_hash,
+    const uint32_t instruction_per_second
+) {
+    if ( !load_rom( library, rom_hash ) )
+        return ecs_iir;
+
+    return execute( instruction_per_second );
+}
+
+echip8_states chip8::record(
+    chip8_string movie_path,
+    const uint32_t instruction_per_second
+) {
+    if ( !rom.exist( ) )
+        return ecs_nip;
+
+    const auto rom_speed = rom.get_instruction_per_second( );
+    const auto speed     = rom_speed > 0 ? rom_speed : instruction_per_second;
+    const auto flags     = hot.flags;
+    auto get_key         = cpu.user_get_key;
+
+    movie.start( get_rom_hash( ), cpu.random.get_seed( ), cpu.random.get_mode( ), speed, flags );
+
+    cpu.set_option( ecc_option_virtual, true );
+    cpu.set_key_callback( chip8_cpu_implementation::exec_get_key_latch );
+
+    movie_mode = ecmv_record;
+
+    const auto state = execute( speed );
+
+    movie_mode = ecmv_none;
+    hot.flags  = flags;
+
+    cpu.set_key_callback( std::move( get_key ) );
+
+    movie.finish( hot.cycles, get_screen_hash( ), get_state_hash( ), state );
+
+    if ( !movie.save( movie_path ) )
+        printf( "> Can't write movie : %s\n", movie_path );
+
+    return state;
+}
+
+std::tuple<bool, echip8_states> chip8::play( chip8_string movie_path ) {
+    if ( !rom.exist( ) )
+        return { false, ecs_nip };
+
+    if ( !movie.load( movie_path ) || movie.get_header( ).rom_hash != get_rom_hash( ) )
+        return { false, ecs_iir };
+
+    const auto& header = movie.get_header( );
+    const auto flags   = hot.flags;
+    auto get_key       = cpu.user_get_key;
+
+    // Quirks change what instructions do, replay with the recorded ones.
+    for ( const auto option : { ecc_option_legacy, ecc_option_stack, ecc_option_idle, ecc_option_vblank } )
+        cpu.set_option( option, header.flags & ( 1 << option ) );
+
+    cpu.set_random_mode( echip8_random_modes( header.random_mode ) );
+    cpu.set_random_seed( header.seed );
+    cpu.set_option( ecc_option_virtual, true );
+    cpu.set_option( ecc_option_limit, false );
+    cpu.set_key_callback( chip8_cpu_implementation::exec_get_key_latch );
+
+    input.clear( );
+
+    movie_mode = ecmv_play;
+
+    const auto state = execute( header.instruction_per_second );
+
+    movie_mode = ecmv_none;
+    hot.flags  = flags;
+
+    cpu.set_key_callback( std::move( get_key ) );
+
+    const auto is_valid = 
+        state == echip8_states( header.final_state ) &&
+        movie.validate( hot.cycles, get_screen_hash( ), get_state_hash( ) );
+
+    return { is_valid, state };
+}
+
+void chip8::save_state( chip8_machine_state& state ) const {
+    state.hot = hot;
+
+    cpu.save_state( state );
+    mmu.save_state( state );
+    smu.save_state( state );
+    rom.save_state( state );
+}
+
+void chip8::load_state( const chip8_machine_state& state ) {
+    hot = state.hot;
+
+    cpu.load_state( state );
+    mmu.load_state( state );
+    smu.load_state( state );
+    rom.load_state( state );
+}
+
 void chip8::dump( const echip8_dump_modes mode ) {
     printf( "\n=== DUMP ===\n" );
 
@@ -170,6 +630,10 @@ void chip8::dump( const echip8_dump_modes mode ) {
         case ecdm_state   : cpu.dump_state( );   break;
         case ecdm_font    : mmu.dump_font( );    break;
         case ecdm_rom     : rom.dump( mmu );     break;
+        case ecdm_pacing  : pacer.dump( );       break;
+
+        case ecdm_opcode_stats : cpu.dump_opcode_stats( ); break;
+        case ecdm_profile      : profiler.dump( );         break;
 
         case ecdm_all :
             cpu.dump( mmu );
@@ -181,6 +645,10 @@ void chip8::dump( const echip8_dump_modes mode ) {
     }
 }
 
+bool chip8::write_opcode_stats( chip8_string stats_path ) const {
+    return cpu.opcodes.write_stats( stats_path );
+}
+
 void chip8::print_exec_state( const echip8_states exec_state ) {
     auto* state_string = "Undefined";
 
@@ -192,6 +660,11 @@ void chip8::print_exec_state( const echip8_states exec_state ) {
         case ecs_uop : state_string = "Unimplemented OPcode"; break;
         case ecs_sgf : state_string = "Seg Fault";            break;
         case ecs_iik : state_string = "Invalid Input Key";    break;
+        case ecs_epv : state_string = "End Of Program Value"; break;
+        case ecs_hlt : state_string = "Halted";               break;
+        case ecs_wfk : state_string = "Waiting For Key";      break;
+        case ecs_ilr : state_string = "Instruction Limit";    break;
+        case ecs_brk : state_string = "Breakpoint";           break;
         default : break;
     }
 
@@ -205,50 +678,261 @@ void chip8::parse_option( chip8_string argument ) {
     switch ( argument[ 1 ] ) {
         case 'i' :
         case 'I' :
-            cpu.set_option( ecc_option_limit, argument[ 2 ] == '1' );
+            set_option( ecc_option_limit, argument[ 2 ] == '1' );
+            break;
+
+        case 'd' :
+        case 'D' :
+            set_option( ecc_option_vblank, argument[ 2 ] == '1' );
+            break;
+
+        case 'f' :
+        case 'F' :
+            set_option( ecc_option_idle, argument[ 2 ] == '1' );
             break;
 
         case 'l' :
         case 'L' :
-            cpu.set_option( ecc_option_legacy, true );
+            set_option( ecc_option_legacy, true );
             break;
 
         case 'p' :
         case 'P' :
-            cpu.set_option( ecc_option_print, argument[ 2 ] == '1' );
+            set_option( ecc_option_print, argument[ 2 ] == '1' );
+            break;
+
+        case 'r' :
+        case 'R' :
+            cpu.set_random_seed( std::strtoull( argument + 2, nullptr, 0 ) );
             break;
 
         case 's' :
         case 'S' :
-            cpu.set_option( ecc_option_stack, argument[ 2 ] == '1' );
+            set_option( ecc_option_stack, argument[ 2 ] == '1' );
+            break;
+
+        case 'v' :
+        case 'V' :
+            set_option( ecc_option_virtual, argument[ 2 ] == '1' );
             break;
 
         default: break;
     }
 }
 
-void chip8::try_wait(
-    const uint32_t instruction_per_second,
-    int& instruction_counter,
-    clock_t::time_point& cycle_start
+bool chip8::load_rom( const chip8_rom_entry& entry ) {
+    if ( !rom.load( mmu, entry.data, entry.size, entry.name ) )
+        return false;
+
+    apply_quirks( entry.quirks );
+
+    rom.set_instruction_per_second( entry.instruction_per_second );
+
+    return true;
+}
+
+void chip8::apply_quirks( const uint8_t quirks ) {
+    // Quirks of the previous ROM never leak to the next one.
+    cpu.set_option( ecc_option_legacy, user_flags & ( 1 << ecc_option_legacy ) );
+    cpu.set_option( ecc_option_stack, user_flags & ( 1 << ecc_option_stack ) );
+
+    if ( quirks & ecq_legacy_set )
+        cpu.set_option( ecc_option_legacy, quirks & ecq_legacy_on );
+
+    if ( quirks & ecq_stack_set )
+        cpu.set_option( ecc_option_stack, !( quirks & ecq_stack_limit ) );
+}
+
+void chip8::begin_events( ) {
+    event_batch = { chip8_event_trace::get( ).now( ), hot.cycles, 0, 0, 0 };
+}
+
+void chip8::trace_events( const uint16_t instruction, const uint32_t frame_period ) {
+    auto& events       = chip8_event_trace::get( );
+    const auto is_draw = ( instruction & 0xF000 ) == 0xD000;
+
+    if ( event_batch.draw_count > 0 && !is_draw ) {
+        events.complete( "DXYN", "draw", event_batch.draw_start, event_batch.draw_cycle, event_batch.draw_count );
+
+        event_batch.draw_count = 0;
+    }
+
+    if ( event_batch.frame_cycle + frame_period <= hot.cycles ) {
+        events.complete( "frame", "emulation", event_batch.frame_start, event_batch.frame_cycle, frame_period );
+
+        event_batch.frame_start = events.now( );
+        event_batch.frame_cycle = hot.cycles;
+    }
+
+    if ( is_draw && event_batch.draw_count++ == 0 ) {
+        event_batch.draw_start = events.now( );
+        event_batch.draw_cycle = hot.cycles;
+    }
+}
+
+void chip8::publish_metrics( const uint64_t frame_count ) {
+    metrics.publish( hot.cycles, smu.get_draw_count( ), pacer.get_stats( ), frame_count );
+
+    // WAV output is written here, never from the timer service thread.
+    cpu.timers.get_audio( ).write_wav( );
+}
+
+void chip8::end_events( ) {
+    auto& events = chip8_event_trace::get( );
+
+    if ( event_batch.draw_count > 0 )
+        events.complete( "DXYN", "draw", event_batch.draw_start, event_batch.draw_cycle, event_batch.draw_count );
+
+    const auto frame_size = uint32_t( hot.cycles - event_batch.frame_cycle );
+
+    events.complete( "frame", "emulation", event_batch.frame_start, event_batch.frame_cycle, frame_size );
+
+    event_batch.draw_count = 0;
+}
+
+void chip8::drain_input( ) {
+    auto event = chip8_input_event{ };
+
+    if ( movie_mode == ecmv_play ) {
+        while ( movie.next( hot.cycles, event ) )
+            apply_input( event );
+
+        return;
+    }
+
+    while ( input.pop( event ) ) {
+        if ( movie_mode == ecmv_record )
+            movie.record( hot.cycles, event );
+
+        apply_input( event );
+    }
+}
+
+void chip8::apply_input( const chip8_input_event& event ) {
+    mmu.set_key( echip8_input_keys( event.key ), event.pressed );
+
+    if ( event.pressed )
+        cpu.state.key_latch = event.key;
+}
+
+echip8_idle_loops chip8::detect_idle_loop( const uint16_t instruction ) {
+    const auto pc = cpu.state.PC;
+
+    // A loop with a breakpoint in its body runs for real to stop on it.
+    if ( ( instruction & 0xF000 ) == 0x1000 )
+        return ( instruction & ecm_nnn ) == pc && !get_breakpoint( pc ) ? ecl_loop_halt : ecl_loop_none;
+
+    if ( ( instruction & 0xF0FF ) != 0xF007 || rom.get_size( ) < pc + 6 )
+        return ecl_loop_none;
+
+    if ( get_breakpoint( pc ) || get_breakpoint( pc + 2 ) || get_breakpoint( pc + 4 ) )
+        return ecl_loop_none;
+
+    const auto skip = rom.fetch( mmu, pc + 2 );
+    const auto jump = rom.fetch( mmu, pc + 4 );
+
+    if ( skip == ( 0x3000 | ( instruction & ecm_x ) ) && jump == ( 0x1000 | pc ) )
+        return ecl_loop_delay;
+
+    return ecl_loop_none;
+}
+
+echip8_states chip8::skip_idle_loop(
+    const echip8_idle_loops idle_loop,
+    const uint16_t instruction,
+    const bool use_virtual,
+    const uint64_t next_tick
 ) {
-    constexpr auto duration = std::chrono::seconds( 1 );
+    if ( !use_virtual ) {
+        while ( get_idle_remaining( idle_loop ) > 0 ) {
+            drain_input( );
 
-    if ( ++instruction_counter == instruction_per_second ) {
-        auto stop = clock_t::now( );
-        auto elapsed = stop - cycle_start;
+            pacer.wait( );
 
-        if ( elapsed < duration )
-            std::this_thread::sleep_for( duration - elapsed );
+            cpu.timers.get_audio( ).write_wav( );
+        }
 
-        instruction_counter = 0;
-        cycle_start = stop;
+        return exit_idle_loop( idle_loop, instruction );
     }
+
+    if ( get_idle_remaining( idle_loop ) == 0 )
+        return idle_loop == ecl_loop_halt ? ecs_hlt : cpu.execute( instruction, mmu, smu );
+
+    // Skip whole iterations ending before the next tick and within the
+    // limit, the loop then runs for real so ticks and the limit land on
+    // the same instruction as without skipping.
+    const auto length  = uint64_t( idle_loop == ecl_loop_halt ? 1 : 3 );
+    const auto horizon = std::min( next_tick - 1, instruction_limit );
+    const auto count   = horizon > hot.cycles ? ( horizon - hot.cycles ) / length : 0;
+
+    if ( count == 0 )
+        return cpu.execute( instruction, mmu, smu );
+
+    // Skipped FX07 left the delay timer in VX.
+    if ( idle_loop == ecl_loop_delay )
+        mmu.v( cpu.nibble( ecn_x, instruction ) ) = cpu.get_delay_timer( );
+
+    hot.cycles += count * length;
+
+    return ecs_run;
+}
+
+echip8_states chip8::exit_idle_loop(
+    const echip8_idle_loops idle_loop,
+    const uint16_t instruction
+) {
+    if ( idle_loop == ecl_loop_halt )
+        return ecs_hlt;
+
+    mmu.v( cpu.nibble( ecn_x, instruction ) ) = 0;
+
+    // Last pass execute FX07 and 3X00 that skip the jump.
+    cpu.state.PC += 6;
+    hot.cycles   += 2;
+
+    return ecs_run;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t chip8::get_rom_hash( ) const {
+    return chip8_hash( mmu.get_rom_memory( ), rom.get_size( ) );
+}
+
+uint64_t chip8::get_state_hash( ) const {
+    auto registers = std::array<uint8_t, 32>{ };
+
+    std::memcpy( registers.data( ), hot.V.data( ), hot.V.size( ) );
+    std::memcpy( registers.data( ) + 16, &hot.PC, sizeof( hot.PC ) );
+    std::memcpy( registers.data( ) + 18, &hot.I, sizeof( hot.I ) );
+    std::memcpy( registers.data( ) + 20, &hot.cycles, sizeof( hot.cycles ) );
+
+    registers[ 28 ] = hot.SP;
+    registers[ 29 ] = hot.delay_timer;
+    registers[ 30 ] = hot.sound_timer;
+
+    const auto memory_hash = chip8_hash( mmu.get_memory( ), chip8_memory_manager_unit::Capacity );
+
+    return chip8_hash( registers.data( ), registers.size( ) ) ^ std::rotl( memory_hash, 1 );
+}
+
+uint8_t chip8::get_idle_remaining( const echip8_idle_loops idle_loop ) const {
+    const auto delay_value = cpu.get_delay_timer( );
+
+    if ( idle_loop == ecl_loop_delay )
+        return delay_value;
+
+    return std::max( delay_value, cpu.get_sound_timer( ) );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
+chip8_hot_state& chip8::get_hot_state( ) {
+    return hot;
+}
+
 chip8_memory_manager_unit& chip8::get_mmu( ) {
     return mmu;
 }
@@ -265,10 +949,42 @@ chip8_rom_manager_unit& chip8::get_rom( ) {
     return rom;
 }
 
+chip8_pacer& chip8::get_pacer( ) {
+    return pacer;
+}
+
+chip8_input_queue& chip8::get_input( ) {
+    return input;
+}
+
+chip8_profiler& chip8::get_profiler( ) {
+    return profiler;
+}
+
+chip8_trace_recorder& chip8::get_trace( ) {
+    return trace;
+}
+
+const chip8_metrics& chip8::get_metrics( ) const {
+    return metrics;
+}
+
+chip8_audio_manager& chip8::get_audio( ) {
+    return cpu.timers.get_audio( );
+}
+
 uint8_t chip8::get_exit_code( ) const {
     return mmu.read( eca_null );
 }
 
+uint64_t chip8::get_screen_hash( ) const {
+    return chip8_hash( smu.get_screen_buffer( ), chip8_screen_manager_unit::dimenion / 8 );
+}
+
+bool chip8::get_breakpoint( const uint16_t cpu_pc ) const {
+    return breakpoints[ uint16_t( cpu_pc & ( chip8_memory_manager_unit::Capacity - 1 ) ) ];
+}
+
 const uint8_t* chip8::get_screen_buffer( ) const {
     return smu.get_screen_buffer( );
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "chip8_cpu_implementation.h"
+#include "chip8_metrics_exporter.h"
 
 /**
  * Define all dumping modes possible.
@@ -15,6 +15,9 @@ enum echip8_dump_modes : uint8_t {
     ecdm_state,
     ecdm_font,
     ecdm_rom,
+    ecdm_pacing,
+    ecdm_opcode_stats,
+    ecdm_profile,
     ecdm_all
 };
 
@@ -24,13 +27,26 @@ enum echip8_dump_modes : uint8_t {
  **/
 class chip8 final {
     
-    using clock_t = std::chrono::steady_clock;
-
 private:
+    chip8_hot_state hot;
     chip8_memory_manager_unit mmu;
     chip8_screen_manager_unit smu;
     chip8_cpu_manager_unit cpu;
     chip8_rom_manager_unit rom;
+    chip8_pacer pacer;
+    chip8_input_queue input;
+    chip8_movie movie;
+    chip8_profiler profiler;
+    chip8_trace_recorder trace;
+    chip8_event_batch event_batch;
+    chip8_metrics metrics;
+    echip8_movie_modes movie_mode;
+    uint64_t instruction_limit;
+    std::vector<chip8_rom_library> bundles;
+    chip8_bitset<chip8_memory_manager_unit::Capacity> breakpoints;
+    uint32_t breakpoint_count;
+    std::atomic<bool> is_interrupted;
+    uint8_t user_flags;
 
 public:
     /**
@@ -129,9 +145,72 @@ public:
      **/
     void set_sound_timer( const uint8_t value );
 
+    /**
+     * set_random_seed method
+     * @note Set machine random generator seed, the sequence restart
+     *       from it on each execute.
+     * @param seed : Target seed.
+     **/
+    void set_random_seed( const uint64_t seed );
+
+    /**
+     * set_random_mode method
+     * @note Set machine random generator mode.
+     * @param mode : Target generator mode.
+     **/
+    void set_random_mode( const echip8_random_modes mode );
+
+    /**
+     * set_instruction_limit method
+     * @note Set instruction count after which execution stops with
+     *       ecs_ilr, instruction count restart on each execute.
+     * @param limit : Target instruction count, UINT64_MAX for none.
+     **/
+    void set_instruction_limit( const uint64_t limit );
+
+    /**
+     * set_breakpoint method
+     * @note Set or clear a breakpoint, resume and run end with ecs_brk
+     *       once an instruction lead to it. Breakpoints are a bitmap
+     *       tested once per instruction, only when one is set.
+     * @param cpu_pc : Target instruction ROM offset.
+     * @param is_set : True to set the breakpoint.
+     **/
+    void set_breakpoint( const uint16_t cpu_pc, const bool is_set );
+
+    /**
+     * clear_breakpoints method
+     * @note Clear every breakpoint.
+     **/
+    void clear_breakpoints( );
+
+    /**
+     * interrupt method
+     * @note Make resume and run end with ecs_ilr after their current
+     *       instruction, safe from any thread. An interrupt sent while
+     *       nothing runs ends the next execution after one instruction.
+     **/
+    void interrupt( );
+
+    /**
+     * start_trace function
+     * @note Record every executed instruction as a binary trace,
+     *       decoded offline with chip8_decoder.
+     * @param trace_path : Target trace file path.
+     * @return True when the trace file was opened.
+     **/
+    bool start_trace( chip8_string trace_path );
+
+    /**
+     * stop_trace method
+     * @note Flush and close current binary trace.
+     **/
+    void stop_trace( );
+
     /**
      * set_option method
-     * @note Set cpu option.
+     * @note Set cpu option, ROM bundle quirks apply on top of it
+     *       for their ROM only.
      * @param option : Target option to update.
      * @param value : Target option value.
      **/
@@ -143,7 +222,8 @@ public:
     /**
      * parse_arguments function
      * @note Parse executable arguments, get ROM list and 
-     *       apply options.
+     *       apply options. ROM bundle are mapped and all their
+     *       ROM names are added to the list.
      * @param argc : Target executable argument count.
      * @param argv : Target executable argument values.
      * @return List of ROM to execute.
@@ -155,11 +235,25 @@ public:
 
     /**
      * load_rom function
-     * @note Load ROM file to the memory.
+     * @note Load ROM file to the memory, ROM from parsed bundles
+     *       are found by name first.
      * @param rom_path : Target ROM file path.
      * @return True when ROM load succeded.
      **/
     bool load_rom( chip8_string rom_path );
+
+    /**
+     * load_rom function
+     * @note Load ROM from a library to the memory, without any
+     *       filesystem access.
+     * @param library : Reference to an opened ROM library.
+     * @param rom_hash : Target ROM content hash.
+     * @return True when ROM load succeded.
+     **/
+    bool load_rom(
+        const chip8_rom_library& library,
+        const uint64_t rom_hash
+    );
     
     /**
      * execute function
@@ -172,6 +266,68 @@ public:
         const uint32_t instruction_per_second = 700
     );
 
+    /**
+     * resume function
+     * @note Continue execution of the currently stored ROM from
+     *       the current machine state, without reset.
+     * @param instruction_per_second : Maximum instruction execution
+     *                                 per second.
+     * @return Emulateur state at the end of ROM execution.
+     **/
+    echip8_states resume(
+        const uint32_t instruction_per_second = 700
+    );
+
+    /**
+     * run function
+     * @note Execute the currently stored ROM as a coroutine, from
+     *       the current machine state. Execution suspends on FX0A
+     *       without latched key and at each frame end, when the frame
+     *       instruction budget is exhausted or on vblank. Timers are
+     *       updated once per resumed frame, get key callback is 
+     *       replaced by the key latch until the execution ends or is
+     *       destroyed.
+     * @param instruction_per_second : Instruction budget per second,
+     *                                 split on 60 frames.
+     * @return Suspended execution, resume it to start.
+     **/
+    chip8_execution run(
+        const uint32_t instruction_per_second = 700
+    );
+
+    /**
+     * step function
+     * @note Execute a single instruction of the currently stored ROM
+     *       for debuggers. Timers are updated each time instruction
+     *       count reach a frame period, so stepping is deterministic
+     *       from a saved state.
+     * @param instruction_per_second : Instruction per second, set
+     *                                 the timers period.
+     * @return Emulateur state after the instruction.
+     **/
+    echip8_states step(
+        const uint32_t instruction_per_second = 700
+    );
+
+    /**
+     * press_key function
+     * @note Queue a key down event, safe to call from one host
+     *       thread while the machine runs. Key is applied at the
+     *       next instruction boundary and latched for FX0A.
+     * @param key : Target key.
+     * @return False when key is invalid or input queue is full.
+     **/
+    bool press_key( const echip8_input_keys key );
+
+    /**
+     * release_key function
+     * @note Queue a key up event, safe to call from one host
+     *       thread while the machine runs.
+     * @param key : Target key.
+     * @return False when key is invalid or input queue is full.
+     **/
+    bool release_key( const echip8_input_keys key );
+
     /**
      * execute function
      * @note Execute a rom with specified instruction per 
@@ -186,6 +342,66 @@ public:
         const uint32_t instruction_per_second = 700
     );
 
+    /**
+     * execute function
+     * @note Execute a rom from a library with specified instruction
+     *       per second limit.
+     * @param library : Reference to an opened ROM library.
+     * @param rom_hash : Target ROM content hash.
+     * @param instruction_per_second : Maximum instruction execution
+     *                                 per second.
+     * @return Emulateur state at the end of ROM execution.
+     **/
+    echip8_states execute(
+        const chip8_rom_library& library,
+        const uint64_t rom_hash,
+        const uint32_t instruction_per_second = 700
+    );
+
+    /**
+     * record function
+     * @note Execute the currently stored ROM while recording key
+     *       events to a movie file. Timers are virtual during the
+     *       recording and input must come from press_key, get key
+     *       callback is replaced by the key latch until it ends.
+     * @param movie_path : Target movie file path.
+     * @param instruction_per_second : Maximum instruction execution
+     *                                 per second.
+     * @return Emulateur state at the end of ROM execution.
+     **/
+    echip8_states record(
+        chip8_string movie_path,
+        const uint32_t instruction_per_second = 700
+    );
+
+    /**
+     * play function
+     * @note Replay a movie on the currently stored ROM unthrottled,
+     *       with the recorded seed and quirks, and compare final machine
+     *       hashes. Get key callback is replaced by the key latch until
+     *       it ends.
+     * @param movie_path : Source movie file path.
+     * @return Tuple of replay validity and emulateur state at the
+     *         end of ROM execution.
+     **/
+    std::tuple<bool, echip8_states> play( chip8_string movie_path );
+
+    /**
+     * save_state method
+     * @note Copy the whole machine to a state, for arena storage
+     *       or save state.
+     * @param state : Target machine state.
+     **/
+    void save_state( chip8_machine_state& state ) const;
+
+    /**
+     * load_state method
+     * @note Restore the whole machine from a state, callbacks and
+     *       opcodes are kept.
+     * @param state : Source machine state.
+     **/
+    void load_state( const chip8_machine_state& state );
+
     /**
      * dump method
      * @note Dump all content for the target mode.
@@ -193,6 +409,15 @@ public:
      **/
     void dump( const echip8_dump_modes mode = ecdm_screen );
 
+    /**
+     * write_opcode_stats function
+     * @note Write opcodes execution statistics as JSON, only
+     *       available when built with CHIP8_OPCODE_STATS.
+     * @param stats_path : Target JSON file path.
+     * @return True when statistics were written.
+     **/
+    bool write_opcode_stats( chip8_string stats_path ) const;
+
     /**
      * print_exec_state method
      * @note Pretty print for target execution return.
@@ -209,23 +434,140 @@ private:
     void parse_option( chip8_string argument );
 
     /**
-     * try_wait method
-     * @note Try to wait some time to execute instruction
-     *       at the "correct" chip8 speed ~( 400Hz - 800Hz ).
-     * @param instruction_per_second : Maximum instruction execution
-     *                                 per second.
-     * @param instruction_counter : Executed instruction count since
-     *                              last try_wait call.
-     * @param cycle_start : Timepoint that represent the start of 
-     *                      current execution sycle sinde last try_wait.
-     **/
-    void try_wait(
-        const uint32_t instruction_per_second,
-        int& instruction_counter,
-        clock_t::time_point& cycle_start
+     * load_rom function
+     * @note Load a ROM library entry and apply its quirks.
+     * @param entry : Target ROM entry.
+     * @return True when ROM load succeded.
+     **/
+    bool load_rom( const chip8_rom_entry& entry );
+
+    /**
+     * apply_quirks method
+     * @note Reset legacy and stack options to the ones set by the
+     *       user, then apply ROM quirks over them.
+     * @param quirks : Target ROM quirks flags from echip8_rom_quirks.
+     **/
+    void apply_quirks( const uint8_t quirks );
+
+    /**
+     * begin_events method
+     * @note Open the first emulated frame event.
+     **/
+    void begin_events( );
+
+    /**
+     * trace_events method
+     * @note Close and open frame and DXYN batch events before an
+     *       instruction execution.
+     * @param instruction : Instruction about to execute.
+     * @param frame_period : Instruction count per emulated frame.
+     **/
+    void trace_events( const uint16_t instruction, const uint32_t frame_period );
+
+    /**
+     * end_events method
+     * @note Close pending frame and DXYN batch events.
+     **/
+    void end_events( );
+
+    /**
+     * publish_metrics method
+     * @note Publish machine counters to metrics and write pending
+     *       audio to the WAV output.
+     * @param frame_count : Emulated frames ended since last publish.
+     **/
+    void publish_metrics( const uint64_t frame_count );
+
+    /**
+     * drain_input method
+     * @note Apply queued key events to the key mask and FX0A latch.
+     **/
+    void drain_input( );
+
+    /**
+     * apply_input method
+     * @note Apply a key event to the key mask and FX0A latch.
+     * @param event : Target key event.
+     **/
+    void apply_input( const chip8_input_event& event );
+
+    /**
+     * detect_idle_loop function
+     * @note Match the idle loop starting at current PC, loop body
+     *       only read timers or jump so machine state is unchanged
+     *       between iterations. Loops with a breakpoint in their
+     *       body are not matched.
+     * @param instruction : Instruction at current PC.
+     * @return Matched idle loop, ecl_loop_none when PC isn't idle.
+     **/
+    echip8_idle_loops detect_idle_loop( const uint16_t instruction );
+
+    /**
+     * skip_idle_loop function
+     * @note Fast-forward time instead of spinning in an idle loop.
+     *       In virtual mode whole iterations are skipped up to the
+     *       next timer tick or the instruction limit, the loop then
+     *       runs for real so cycles, PC and registers match a run
+     *       without skipping. Otherwise frames are slept until the
+     *       timers expire, with input drained each frame.
+     * @param idle_loop : Matched idle loop.
+     * @param instruction : Instruction at current PC.
+     * @param use_virtual : True when timers are ticked by instruction count,
+     *                      frames are slept otherwise.
+     * @param next_tick : Instruction count of next virtual timer tick.
+     * @return ecs_hlt for jump to self with expired timers, execution
+     *         state otherwise.
+     **/
+    echip8_states skip_idle_loop(
+        const echip8_idle_loops idle_loop,
+        const uint16_t instruction,
+        const bool use_virtual,
+        const uint64_t next_tick
     );
 
+    /**
+     * exit_idle_loop function
+     * @note Leave an idle loop once its timers expired.
+     * @param idle_loop : Matched idle loop.
+     * @param instruction : Instruction at current PC.
+     * @return ecs_hlt for jump to self, ecs_run otherwise.
+     **/
+    echip8_states exit_idle_loop(
+        const echip8_idle_loops idle_loop,
+        const uint16_t instruction
+    );
+
+private:
+    /**
+     * get_idle_remaining function
+     * @note Get timer ticks left before an idle loop exit.
+     * @param idle_loop : Matched idle loop.
+     * @return Remaining timer ticks.
+     **/
+    uint8_t get_idle_remaining( const echip8_idle_loops idle_loop ) const;
+
+    /**
+     * get_rom_hash function
+     * @note Get loaded ROM content hash.
+     * @return ROM content hash.
+     **/
+    uint64_t get_rom_hash( ) const;
+
+    /**
+     * get_state_hash function
+     * @note Get registers, timers, instruction count and memory hash.
+     * @return Machine state hash.
+     **/
+    uint64_t get_state_hash( ) const;
+
 public:
+    /**
+     * get_hot_state function
+     * @note Get reference to machine hot state.
+     * @return Reference to machine hot state.
+     **/
+    chip8_hot_state& get_hot_state( );
+
     /**
      * get_mmu function
      * @note Get reference to current memory manager unit.
@@ -254,6 +596,49 @@ public:
      **/
     chip8_rom_manager_unit& get_rom( );
 
+    /**
+     * get_pacer function
+     * @note Get reference to execution pacer.
+     * @return Reference to execution pacer.
+     **/
+    chip8_pacer& get_pacer( );
+
+    /**
+     * get_input function
+     * @note Get reference to key event queue.
+     * @return Reference to key event queue.
+     **/
+    chip8_input_queue& get_input( );
+
+    /**
+     * get_profiler function
+     * @note Get reference to PC and call stack profiler.
+     * @return Reference to profiler.
+     **/
+    chip8_profiler& get_profiler( );
+
+    /**
+     * get_trace function
+     * @note Get reference to binary trace recorder.
+     * @return Reference to binary trace recorder.
+     **/
+    chip8_trace_recorder& get_trace( );
+
+    /**
+     * get_metrics function
+     * @note Get machine metrics, readable from any thread.
+     * @return Reference to immutable machine metrics.
+     **/
+    const chip8_metrics& get_metrics( ) const;
+
+    /**
+     * get_audio function
+     * @note Get reference to audio manager, audio is disabled
+     *       until enabled with a sample rate.
+     * @return Reference to audio manager.
+     **/
+    chip8_audio_manager& get_audio( );
+
     /**
      * get_exit_code function
      * @note Get the return value of a program ended 
@@ -262,6 +647,21 @@ public:
      */
     uint8_t get_exit_code( ) const;
 
+    /**
+     * get_screen_hash function
+     * @note Get screen buffer hash.
+     * @return Screen buffer hash.
+     **/
+    uint64_t get_screen_hash( ) const;
+
+    /**
+     * get_breakpoint function
+     * @note Get if a breakpoint is set.
+     * @param cpu_pc : Target instruction ROM offset.
+     * @return True when a breakpoint is set.
+     **/
+    bool get_breakpoint( const uint16_t cpu_pc ) const;
+
     /**
      * get_screen_buffer function
      * @note Get access to screen buffer.
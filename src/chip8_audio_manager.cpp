@@ -0,0 +1,302 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_audio_manager::chip8_audio_manager( )
+    : head{ 0 },
+    tail{ 0 },
+    users{ 0 },
+    is_suspended{ false },
+    samples{ },
+    pattern{ },
+    wav{ },
+    mode{ ecam_square },
+    sample_rate{ 0 },
+    frequency{ 440 },
+    remainder{ 0 },
+    phase{ 0 },
+    square_step{ 0 },
+    pattern_step{ 0 },
+    wav_samples{ 0 },
+    overruns{ 0 },
+    volume{ 8192 },
+    pitch{ 64 }
+{ }
+
+chip8_audio_manager::~chip8_audio_manager( ) {
+    close_wav( );
+}
+
+void chip8_audio_manager::enable( const uint32_t rate, const uint32_t capacity ) {
+    auto ring_capacity = uint32_t( 1 );
+
+    while ( ring_capacity < capacity )
+        ring_capacity <<= 1;
+
+    suspend( );
+
+    samples.assign( ring_capacity, 0 );
+
+    head.store( 0 );
+    tail.store( 0 );
+
+    sample_rate = rate;
+    remainder   = 0;
+    phase       = 0;
+    overruns    = 0;
+
+    update_steps( );
+    resume( );
+}
+
+void chip8_audio_manager::disable( ) {
+    suspend( );
+    finish_wav( );
+
+    sample_rate = 0;
+
+    samples.clear( );
+
+    resume( );
+}
+
+void chip8_audio_manager::set_tone( const uint32_t tone_frequency, const int16_t amplitude ) {
+    suspend( );
+
+    frequency = tone_frequency;
+    volume    = amplitude;
+
+    update_steps( );
+    resume( );
+}
+
+void chip8_audio_manager::set_pattern( const uint8_t* pattern_data, const uint8_t pattern_pitch ) {
+    suspend( );
+
+    std::memcpy( pattern.data( ), pattern_data, PatternSize );
+
+    pitch = pattern_pitch;
+    mode  = ecam_pattern;
+
+    update_steps( );
+    resume( );
+}
+
+void chip8_audio_manager::set_mode( const echip8_audio_modes audio_mode ) {
+    suspend( );
+
+    mode = audio_mode;
+
+    resume( );
+}
+
+void chip8_audio_manager::generate( const bool is_sounding ) {
+    if ( enter( ) && sample_rate > 0 ) {
+        auto count = sample_rate / 60;
+
+        remainder += sample_rate % 60;
+
+        if ( remainder >= 60 ) {
+            remainder -= 60;
+            count     += 1;
+        }
+
+        const auto mask    = uint32_t( samples.size( ) ) - 1;
+        const auto tail_id = tail.load( std::memory_order_relaxed );
+        const auto free    = uint32_t( samples.size( ) ) - ( tail_id - head.load( std::memory_order_acquire ) );
+        const auto written = std::min( count, free );
+
+        // Dropped samples still advance the phase, audio stay in step.
+        for ( auto sample_id = uint32_t( 0 ); sample_id < count; sample_id++ ) {
+            const auto sample = is_sounding ? next_sample( ) : int16_t( 0 );
+
+            if ( sample_id < written )
+                samples[ ( tail_id + sample_id ) & mask ] = sample;
+        }
+
+        tail.store( tail_id + written, std::memory_order_release );
+
+        overruns += count - written;
+    }
+
+    users.fetch_sub( 1 );
+}
+
+uint32_t chip8_audio_manager::read( int16_t* output, const uint32_t count ) {
+    auto length = uint32_t( 0 );
+
+    if ( enter( ) && !samples.empty( ) && !wav.is_open( ) ) {
+        const auto mask    = uint32_t( samples.size( ) ) - 1;
+        const auto head_id = head.load( std::memory_order_relaxed );
+        const auto ready   = tail.load( std::memory_order_acquire ) - head_id;
+
+        length = std::min( count, ready );
+
+        for ( auto sample_id = uint32_t( 0 ); sample_id < length; sample_id++ )
+            output[ sample_id ] = samples[ ( head_id + sample_id ) & mask ];
+
+        head.store( head_id + length, std::memory_order_release );
+    }
+
+    users.fetch_sub( 1 );
+
+    return length;
+}
+
+uint32_t chip8_audio_manager::write_wav( ) {
+    const auto length = enter( ) ? flush_wav( ) : uint32_t( 0 );
+
+    users.fetch_sub( 1 );
+
+    return length;
+}
+
+bool chip8_audio_manager::open_wav( chip8_string wav_path ) {
+    suspend( );
+    finish_wav( );
+
+    wav.open( wav_path, std::ios::binary | std::ios::trunc );
+
+    wav_samples = 0;
+
+    if ( wav.is_open( ) )
+        write_wav_header( );
+
+    const auto is_open = wav.good( );
+
+    resume( );
+
+    return is_open;
+}
+
+void chip8_audio_manager::close_wav( ) {
+    suspend( );
+    finish_wav( );
+    resume( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_audio_manager::enter( ) {
+    // Count the call before checking the flag, see suspend.
+    users.fetch_add( 1 );
+
+    return !is_suspended.load( );
+}
+
+void chip8_audio_manager::suspend( ) {
+    is_suspended.store( true );
+
+    // A call that didn't see the flag is still counted and waited
+    // for, later calls see the flag and leave the ring untouched.
+    while ( users.load( ) > 0 )
+        std::this_thread::yield( );
+}
+
+void chip8_audio_manager::resume( ) {
+    is_suspended.store( false );
+}
+
+uint32_t chip8_audio_manager::flush_wav( ) {
+    if ( samples.empty( ) || !wav.is_open( ) )
+        return 0;
+
+    const auto mask    = uint32_t( samples.size( ) ) - 1;
+    const auto head_id = head.load( std::memory_order_relaxed );
+    const auto ready   = tail.load( std::memory_order_acquire ) - head_id;
+    const auto first   = head_id & mask;
+
+    // Write up to the ring end, then the wrapped part.
+    const auto length = std::min( ready, uint32_t( samples.size( ) ) - first );
+
+    wav.write( (const char*)( samples.data( ) + first ), length * sizeof( int16_t ) );
+    wav.write( (const char*)samples.data( ), ( ready - length ) * sizeof( int16_t ) );
+
+    head.store( head_id + ready, std::memory_order_release );
+
+    wav_samples += ready;
+
+    return ready;
+}
+
+void chip8_audio_manager::finish_wav( ) {
+    if ( !wav.is_open( ) )
+        return;
+
+    flush_wav( );
+
+    wav.seekp( 0 );
+
+    write_wav_header( );
+
+    wav.close( );
+}
+
+int16_t chip8_audio_manager::next_sample( ) {
+    auto is_high = false;
+
+    if ( mode == ecam_pattern ) {
+        const auto bit_id = phase >> 25;
+
+        is_high = ( pattern[ bit_id >> 3 ] >> ( 7 - ( bit_id & 7 ) ) ) & 0x01;
+        phase  += pattern_step;
+    } else {
+        is_high = phase & 0x80000000;
+        phase  += square_step;
+    }
+
+    return is_high ? volume : int16_t( -volume );
+}
+
+void chip8_audio_manager::update_steps( ) {
+    if ( sample_rate == 0 )
+        return;
+
+    // Phase is a 32 bits fraction of a period, pattern period is 128 bits.
+    const auto bit_rate = 4000.0 * std::pow( 2.0, ( double( pitch ) - 64.0 ) / 48.0 );
+
+    square_step  = uint32_t( double( frequency ) * 4294967296.0 / double( sample_rate ) );
+    pattern_step = uint32_t( bit_rate / 128.0 * 4294967296.0 / double( sample_rate ) );
+}
+
+void chip8_audio_manager::write_wav_header( ) {
+    const auto data_size = wav_samples * uint32_t( sizeof( int16_t ) );
+    const auto byte_rate = sample_rate * uint32_t( sizeof( int16_t ) );
+
+    auto write_u32 = [ & ]( const uint32_t value ) { wav.write( (const char*)&value, sizeof( value ) ); };
+    auto write_u16 = [ & ]( const uint16_t value ) { wav.write( (const char*)&value, sizeof( value ) ); };
+
+    wav.write( "RIFF", 4 );
+    write_u32( 36 + data_size );
+    wav.write( "WAVEfmt ", 8 );
+    write_u32( 16 );
+    write_u16( 1 );
+    write_u16( 1 );
+    write_u32( sample_rate );
+    write_u32( byte_rate );
+    write_u16( sizeof( int16_t ) );
+    write_u16( 16 );
+    wav.write( "data", 4 );
+    write_u32( data_size );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_audio_manager::is_enabled( ) const {
+    return sample_rate > 0;
+}
+
+uint32_t chip8_audio_manager::get_sample_rate( ) const {
+    return sample_rate;
+}
+
+uint32_t chip8_audio_manager::get_available( ) const {
+    return tail.load( std::memory_order_acquire ) - head.load( std::memory_order_acquire );
+}
+
+uint64_t chip8_audio_manager::get_overruns( ) const {
+    return overruns;
+}
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "chip8_smu.h"
+
+/**
+ * chip8_audio_manager class
+ * @note Synthesize 16 bits mono PCM from the sound timer, one
+ *       timer tick worth of samples at a time so audio stay sample
+ *       accurate with emulated time. Samples are pushed to a 
+ *       lock-free single producer single consumer ring read by the
+ *       host audio thread, or written to a WAV file by the
+ *       emulation thread for headless runs.
+ *       The producer may be the shared timer service thread, so a
+ *       tick only synthesize into the ring. Configuration and WAV
+ *       methods suspend the producer and consumers and wait for the
+ *       calls in flight, they must be called from one host thread
+ *       at a time.
+ **/
+class chip8_audio_manager final {
+
+public:
+    static constexpr uint32_t PatternSize = 16;
+
+private:
+    alignas( 64 ) std::atomic<uint32_t> head;
+    alignas( 64 ) std::atomic<uint32_t> tail;
+    alignas( 64 ) std::atomic<uint32_t> users;
+    std::atomic<bool> is_suspended;
+    std::vector<int16_t> samples;
+    std::array<uint8_t, PatternSize> pattern;
+    std::ofstream wav;
+    echip8_audio_modes mode;
+    uint32_t sample_rate;
+    uint32_t frequency;
+    uint32_t remainder;
+    uint32_t phase;
+    uint32_t square_step;
+    uint32_t pattern_step;
+    uint32_t wav_samples;
+    uint64_t overruns;
+    int16_t volume;
+    uint8_t pitch;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_audio_manager( );
+
+    /**
+     * Destructor
+     **/
+    ~chip8_audio_manager( );
+
+    /**
+     * enable method
+     * @note Enable synthesis, ring capacity is rounded up to a
+     *       power of two.
+     * @param rate : Target sample rate in Hz.
+     * @param capacity : Ring capacity in samples.
+     **/
+    void enable( const uint32_t rate, const uint32_t capacity = 8192 );
+
+    /**
+     * disable method
+     * @note Disable synthesis and close WAV output.
+     **/
+    void disable( );
+
+    /**
+     * set_tone method
+     * @note Set square wave tone.
+     * @param frequency : Tone frequency in Hz.
+     * @param amplitude : Sample amplitude.
+     **/
+    void set_tone( const uint32_t frequency, const int16_t amplitude );
+
+    /**
+     * set_pattern method
+     * @note Set XO-CHIP audio pattern and pitch, switch to pattern
+     *       mode.
+     * @param pattern_data : Pattern bits, 16 bytes.
+     * @param pitch : XO-CHIP pitch, 64 play 4000 bits per second.
+     **/
+    void set_pattern( const uint8_t* pattern_data, const uint8_t pitch );
+
+    /**
+     * set_mode method
+     * @note Set synthesis mode.
+     * @param audio_mode : Target synthesis mode.
+     **/
+    void set_mode( const echip8_audio_modes audio_mode );
+
+    /**
+     * generate method
+     * @note Synthesize one timer tick worth of samples, producer
+     *       side only. Never lock, block or write files, the tick
+     *       is skipped while configuration is changed.
+     * @param is_sounding : True when sound timer was active for the tick.
+     **/
+    void generate( const bool is_sounding );
+
+    /**
+     * read function
+     * @note Pop samples from the ring, consumer side only. Nothing
+     *       is read while a WAV file is open.
+     * @param output : Target sample buffer.
+     * @param count : Maximum sample count to read.
+     * @return Read sample count.
+     **/
+    uint32_t read( int16_t* output, const uint32_t count );
+
+    /**
+     * write_wav function
+     * @note Write pending samples to the WAV file, consumer side,
+     *       chip8 call it from the emulation thread at each frame.
+     * @return Written sample count.
+     **/
+    uint32_t write_wav( );
+
+    /**
+     * open_wav function
+     * @note Start writing generated samples to a WAV file instead
+     *       of the host consumer.
+     * @param wav_path : Target WAV file path.
+     * @return True when file is opened.
+     **/
+    bool open_wav( chip8_string wav_path );
+
+    /**
+     * close_wav method
+     * @note Write pending samples, finish WAV file header and close
+     *       it.
+     **/
+    void close_wav( );
+
+private:
+    /**
+     * enter function
+     * @note Register a producer or consumer call, skipped while
+     *       suspended.
+     * @return True when the call can touch the ring.
+     **/
+    bool enter( );
+
+    /**
+     * suspend method
+     * @note Stop producer and consumers and wait for the calls in
+     *       flight, so configuration is never changed under a
+     *       running tick or read.
+     **/
+    void suspend( );
+
+    /**
+     * resume method
+     * @note Let producer and consumers run again.
+     **/
+    void resume( );
+
+    /**
+     * flush_wav function
+     * @note Write pending samples to the WAV file, caller must own
+     *       the ring.
+     * @return Written sample count.
+     **/
+    uint32_t flush_wav( );
+
+    /**
+     * finish_wav method
+     * @note Flush, write final header and close the WAV file, caller
+     *       must own the ring.
+     **/
+    void finish_wav( );
+
+    /**
+     * next_sample function
+     * @note Synthesize next sample for current mode.
+     * @return Sample value.
+     **/
+    int16_t next_sample( );
+
+    /**
+     * update_steps method
+     * @note Compute phase steps for current rate, tone and pitch.
+     **/
+    void update_steps( );
+
+    /**
+     * write_wav_header method
+     * @note Write WAV header for current sample count.
+     **/
+    void write_wav_header( );
+
+public:
+    /**
+     * is_enabled function
+     * @note Get if synthesis is enabled.
+     * @return True when enabled.
+     **/
+    bool is_enabled( ) const;
+
+    /**
+     * get_sample_rate function
+     * @note Get sample rate.
+     * @return Sample rate in Hz, 0 when disabled.
+     **/
+    uint32_t get_sample_rate( ) const;
+
+    /**
+     * get_available function
+     * @note Get sample count ready to read.
+     * @return Available sample count.
+     **/
+    uint32_t get_available( ) const;
+
+    /**
+     * get_overruns function
+     * @note Get sample count dropped on full ring.
+     * @return Dropped sample count.
+     **/
+    uint64_t get_overruns( ) const;
+
+};
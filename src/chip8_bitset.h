@@ -10,8 +10,10 @@
 template<uint16_t Capacity>
 class chip8_bitset final {
 
+public:
     static constexpr uint16_t dimension = Capacity / 8;
 
+private:
     /**
      * chip8_bitset_proxy class
      * @note Define for operator[] hacking.
@@ -96,6 +98,16 @@ private:
             buffer[ byte_id ] &= ~( 1 << offset );
     };
 
+public:
+    /**
+     * set method
+     * @note Overwrite the whole bitset content.
+     * @param data : Source buffer of dimension bytes.
+     **/
+    void set( const uint8_t* data ) {
+        std::memcpy( buffer.data( ), data, dimension );
+    };
+
 public:
     /**
      * get function
@@ -4,30 +4,63 @@
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 chip8_cpu_manager_unit::chip8_cpu_manager_unit(
+    chip8_hot_state& hot_state,
     const bool legacy_mode,
     const bool enable_print,
     const bool enable_stack_limit
 )
-    : PC{ 0 },
-    I{ 0 },
-    timers{ },
+    : state{ hot_state },
+    timers{ hot_state },
     opcodes{ },
-    options{ }
+    options{ hot_state },
+    random{ },
+    trace{ nullptr }
 {
     set_option( ecc_option_legacy, legacy_mode );
     set_option( ecc_option_print, enable_print );
     set_option( ecc_option_stack, !enable_stack_limit );
+
+    state.key_latch = eci_key_undefined;
 }
 
 void chip8_cpu_manager_unit::set_make_noise( chip8_make_noise_callback&& callback ) {
     timers.set_make_noise( std::move( callback ) );
 }
 
+void chip8_cpu_manager_unit::set_trace( chip8_trace_recorder* recorder ) {
+    trace = recorder;
+}
+
 void chip8_cpu_manager_unit::reset( ) {
-    PC = 0;
-    I  = 0;
+    state.PC     = 0;
+    state.I      = 0;
+    state.cycles = 0;
+
+    state.key_latch = eci_key_undefined;
 
     timers.reset( );
+    random.reset( );
+    opcodes.reset_stats( );
+}
+
+void chip8_cpu_manager_unit::set_random_seed( const uint64_t seed ) {
+    random.set_seed( seed );
+}
+
+void chip8_cpu_manager_unit::set_random_mode( const echip8_random_modes mode ) {
+    random.set_mode( mode );
+}
+
+uint32_t chip8_cpu_manager_unit::next_random( ) const {
+    return random.next( );
+}
+
+void chip8_cpu_manager_unit::save_state( chip8_machine_state& machine_state ) const {
+    random.save_state( machine_state );
+}
+
+void chip8_cpu_manager_unit::load_state( const chip8_machine_state& machine_state ) {
+    random.load_state( machine_state );
 }
 
 void chip8_cpu_manager_unit::set_delay_timer( const uint8_t value ) {
@@ -88,17 +121,18 @@ void chip8_cpu_manager_unit::print_instruction(
         default : break;
     }
 
-    std::snprintf( buffer_str, line_size, "%04X | 0x%X 0x%03X 0x%03X 0x%03X |", PC, opcode, x, y, n );
+    std::snprintf( buffer_str, line_size, "%04X | 0x%X 0x%03X 0x%03X 0x%03X |", state.PC, opcode, x, y, n );
 
     printf( "%s\n", buffer_str );
 }
 
 void chip8_cpu_manager_unit::update_timers( ) {
-    timers.update( );
+    timers.update( state.cycles );
 }
 
 void chip8_cpu_manager_unit::consume( ) { 
-    PC += 2; 
+    state.PC     += 2; 
+    state.cycles += 1;
 }
 
 echip8_states chip8_cpu_manager_unit::execute(
@@ -108,7 +142,24 @@ echip8_states chip8_cpu_manager_unit::execute(
 ) {
     consume( );
 
-    return opcodes.execute( instruction, chip8_self, mmu, smu );
+    if ( !trace )
+        return opcodes.execute( instruction, chip8_self, mmu, smu );
+
+    const auto cpu_pc     = state.PC;
+    const auto exec_state = opcodes.execute( instruction, chip8_self, mmu, smu );
+
+    // Written register come from the opcode, FX0A write none while waiting.
+    auto record = chip8_trace_record{ state.cycles, cpu_pc, instruction, state.I, chip8_trace_recorder::Unchanged, 0 };
+
+    if ( exec_state != ecs_wfk )
+        record.register_id = chip8_trace_recorder::get_register( instruction );
+
+    if ( record.register_id != chip8_trace_recorder::Unchanged )
+        record.value = state.V[ record.register_id ];
+
+    trace->record( record );
+
+    return exec_state;
 }
 
 void chip8_cpu_manager_unit::dump_timers(  ) const {
@@ -119,12 +170,16 @@ void chip8_cpu_manager_unit::dump_opcodes( ) const {
     opcodes.dump( );
 }
 
+void chip8_cpu_manager_unit::dump_opcode_stats( ) const {
+    opcodes.dump_stats( );
+}
+
 void chip8_cpu_manager_unit::dump_options( ) const {
     options.dump( );
 }
 
 void chip8_cpu_manager_unit::dump_state( ) const {
-    printf( "PC 0x%04X\nI 0x0%04X\n", PC, I );
+    printf( "PC 0x%04X\nI 0x0%04X\n", state.PC, state.I );
 }
 
 void chip8_cpu_manager_unit::dump( chip8_memory_manager_unit& mmu ) const {
@@ -205,7 +260,12 @@ std::tuple<bool, uint8_t> chip8_cpu_manager_unit::get_key(
     auto key       = uint8_t( eci_key_undefined );
 
     if ( user_get_key ) {
+        auto get_key_scope = chip8_event_scope{ "get_key", "callback", state.cycles };
+
         const auto key_value = std::invoke( user_get_key, instruction, chip8_self, mmu );
+
+        if ( key_value == eci_key_pending )
+            return { false, eci_key_pending };
         
         if ( key_valid = validate_key( key_value ) ) {
             key = key_value;
@@ -1,22 +1,25 @@
 #pragma once
 
-#include "chip8_cpu_option_manager.h"
+#include "chip8_trace.h"
 
 /**
  * chip8_cpu_manager_unit class
- * @note Store and manage cpu specific logic.
+ * @note Store and manage cpu specific logic, PC and I live in
+ *       the machine hot state.
  **/
 struct chip8_cpu_manager_unit final {
 
-    uint16_t PC;
-    uint16_t I;
+    chip8_hot_state& state;
     chip8_cpu_timer_manager timers;
     chip8_cpu_opcode_manager opcodes;
     chip8_cpu_option_manager options;
+    mutable chip8_cpu_random_manager random;
+    chip8_trace_recorder* trace;
     chip8_get_key_callback user_get_key;
 
     /**
      * Constructor
+     * @param hot_state : Reference to machine hot state.
      * @param legacy_mode : True to use this to make vx = vy before 
      *                      shift instructio calls.
      * @param enable_print : True to use printing during execution.
@@ -24,6 +27,7 @@ struct chip8_cpu_manager_unit final {
      *                             calls, origninal chip8 limit.
      **/
     chip8_cpu_manager_unit(
+        chip8_hot_state& hot_state,
         const bool legacy_mode,
         const bool enable_print,
         const bool enable_stack_limit
@@ -36,6 +40,13 @@ struct chip8_cpu_manager_unit final {
      **/
     void set_make_noise( chip8_make_noise_callback&& callback );
 
+    /**
+     * set_trace method
+     * @note Set binary trace recorder fed by execute.
+     * @param recorder : Target recorder, nullptr to disable.
+     **/
+    void set_trace( chip8_trace_recorder* recorder );
+
     /**
      * reset method
      * @note Reset cpu to initial execution state, timers at default 
@@ -43,6 +54,42 @@ struct chip8_cpu_manager_unit final {
      **/
     void reset( );
 
+    /**
+     * set_random_seed method
+     * @note Set random generator seed and restart its sequence.
+     * @param seed : Target seed.
+     **/
+    void set_random_seed( const uint64_t seed );
+
+    /**
+     * set_random_mode method
+     * @note Set random generator mode and restart its sequence.
+     * @param mode : Target generator mode.
+     **/
+    void set_random_mode( const echip8_random_modes mode );
+
+    /**
+     * next_random function
+     * @note Get next value of machine random generator, const so
+     *       get key callbacks can use it.
+     * @return Random value.
+     **/
+    uint32_t next_random( ) const;
+
+    /**
+     * save_state method
+     * @note Copy random generator state to a machine state.
+     * @param machine_state : Target machine state.
+     **/
+    void save_state( chip8_machine_state& machine_state ) const;
+
+    /**
+     * load_state method
+     * @note Copy random generator state from a machine state.
+     * @param machine_state : Source machine state.
+     **/
+    void load_state( const chip8_machine_state& machine_state );
+
     /**
      * set_delay_timer method
      * @note Set delay timer value.
@@ -103,7 +150,8 @@ struct chip8_cpu_manager_unit final {
 
     /**
      * update_timers method
-     * @note Update delay and sound timers.
+     * @note Update delay and sound timers at current instruction
+     *       count, emulation thread only.
      **/
     void update_timers( );
 
@@ -139,6 +187,12 @@ struct chip8_cpu_manager_unit final {
      **/
     void dump_opcodes( ) const;
 
+    /**
+     * dump_opcode_stats method
+     * @note Dump opcodes execution statistics.
+     **/
+    void dump_opcode_stats( ) const;
+
     /**
      * dump_options method
      * @note Dump option value and names.
@@ -236,7 +290,8 @@ struct chip8_cpu_manager_unit final {
      * @note Get key logic execution.
      * @param instruction : Target instruction.
      * @param mmu : Reference to current memory management unit.
-     * @return Tuple of key validity and key value in range (0-9,a-b).
+     * @return Tuple of key validity and key value in range (0-9,a-b),
+     *         eci_key_pending when the callback has no key yet.
      **/
     std::tuple<bool, uint8_t> get_key(
         const uint16_t instruction,
@@ -244,3 +299,52 @@ struct chip8_cpu_manager_unit final {
     ) const;
 
 };
+
+/**
+ * chip8_key_scope class
+ * @note Replace the cpu get key callback for the scope lifetime,
+ *       previous callback is restored on destruction, even when a
+ *       suspended execution is destroyed before its end.
+ **/
+class chip8_key_scope final {
+
+private:
+    chip8_cpu_manager_unit& cpu;
+    chip8_get_key_callback get_key;
+
+public:
+    /**
+     * Constructor
+     * @param cpu_unit : Reference to target cpu manager unit.
+     * @param callback : Get key callback used during the scope.
+     **/
+    chip8_key_scope(
+        chip8_cpu_manager_unit& cpu_unit,
+        chip8_get_key_callback&& callback
+    )
+        : cpu{ cpu_unit },
+        get_key{ std::move( cpu_unit.user_get_key ) }
+    {
+        cpu.set_key_callback( std::move( callback ) );
+    };
+
+    /**
+     * Copy-Constructor
+     * @note Scope can't be copied.
+     **/
+    chip8_key_scope( const chip8_key_scope& ) = delete;
+
+    /**
+     * Destructor
+     **/
+    ~chip8_key_scope( ) {
+        cpu.set_key_callback( std::move( get_key ) );
+    };
+
+    /**
+     * operator=
+     * @note Scope can't be copied.
+     **/
+    chip8_key_scope& operator=( const chip8_key_scope& ) = delete;
+
+};
@@ -21,13 +21,15 @@ namespace chip8_cpu_implementation {
 
             return ecs_epv;
         } else if ( instruction == 0x00E0 ) {
+            auto clear_scope = chip8_event_scope{ "clear", "callback", cpu.state.cycles };
+
             smu.clear( );
 
             return ecs_run;
-        } else if ( instruction != 0x00EE ) {
+        } else if ( instruction == 0x00EE ) {
             const auto tuple = mmu.pop( );
 
-            cpu.PC = std::get<uint16_t>( tuple );
+            cpu.state.PC = std::get<uint16_t>( tuple );
 
             return std::get<bool>( tuple ) ? ecs_run : ecs_sgf;
         }
@@ -43,7 +45,7 @@ namespace chip8_cpu_implementation {
     ) {
         cpu.print_instruction( instruction, ecf_nnn );
 
-        cpu.PC = cpu.address( instruction );
+        cpu.state.PC = cpu.address( instruction );
 
         return ecs_run;
     }
@@ -59,8 +61,8 @@ namespace chip8_cpu_implementation {
         const auto stack_option = cpu.get_option( ecc_option_stack );
         const auto nnn          = cpu.address( instruction );
 
-        if ( mmu.push( cpu.PC, stack_option ) ) {
-            cpu.PC = nnn;
+        if ( mmu.push( cpu.state.PC, stack_option ) ) {
+            cpu.state.PC = nnn;
 
             return ecs_run;
         }
@@ -233,7 +235,7 @@ namespace chip8_cpu_implementation {
     ) {
         cpu.print_instruction( instruction, ecf_nnn );
 
-        cpu.I = cpu.address( instruction );
+        cpu.state.I = cpu.address( instruction );
         
         return ecs_run;
     }
@@ -248,7 +250,7 @@ namespace chip8_cpu_implementation {
 
         const auto nnn = cpu.address( instruction );
 
-        cpu.PC = nnn + mmu.v( 0 );
+        cpu.state.PC = nnn + mmu.v( 0 );
 
         return ecs_run;
     }
@@ -263,7 +265,7 @@ namespace chip8_cpu_implementation {
 
         const auto x = cpu.nibble( ecn_x, instruction );
 
-        mmu.v( x ) = uint8_t( rand( ) ) & cpu.nibble( ecn_nn, instruction );
+        mmu.v( x ) = uint8_t( cpu.next_random( ) ) & cpu.nibble( ecn_nn, instruction );
 
         return ecs_run;
     }
@@ -313,6 +315,12 @@ namespace chip8_cpu_implementation {
     ) {
         const auto [ is_valid, key ] = cpu.get_key( instruction, mmu );
         
+        if ( key == eci_key_pending ) {
+            cpu.state.PC -= 2;
+
+            return ecs_wfk;
+        }
+
         if ( is_valid ) {
             const auto x = cpu.nibble( ecn_x, instruction );
 
@@ -359,26 +367,26 @@ namespace chip8_cpu_implementation {
                 }
                 break;
 
-            case 0x1E : cpu.I += mmu.v( x ); break; // Add to index
-            case 0x29 : cpu.I  = mmu.v( x ); break; // Font character
+            case 0x1E : cpu.state.I += mmu.v( x ); break; // Add to index
+            case 0x29 : cpu.state.I  = mmu.v( x ); break; // Font character
 
             //  Binary-coded decimal conversion
             case 0x33 :
-                mmu.write( cpu.I    , mmu.v( x ) / 100        );
-                mmu.write( cpu.I + 1, ( mmu.v( x ) / 10 ) %10 );
-                mmu.write( cpu.I + 2, mmu.v( x ) % 10         );
+                mmu.write( cpu.state.I    , mmu.v( x ) / 100        );
+                mmu.write( cpu.state.I + 1, ( mmu.v( x ) / 10 ) %10 );
+                mmu.write( cpu.state.I + 2, mmu.v( x ) % 10         );
                 break;
             
             //Store memory
             case 0x55 :
                 for ( auto i = 0; i < (x+1); i++ )
-                    mmu.write( cpu.I + i, mmu.v( i ) );
+                    mmu.write( cpu.state.I + i, mmu.v( i ) );
                 break;
 
             // Load memory
             case 0x65 :
                 for ( auto i = 0; i < (x+1); i++ )
-                    mmu.v( i ) = mmu.read( cpu.I + i );
+                    mmu.v( i ) = mmu.read( cpu.state.I + i );
                 break;
 
             default : break;
@@ -399,12 +407,27 @@ namespace chip8_cpu_implementation {
         return cpu.try_map_key( key );
     }
 
+    uint8_t exec_get_key_latch(
+        const uint16_t instruction,
+        const chip8_cpu_manager_unit& cpu,
+        const chip8_memory_manager_unit& mmu
+    ) {
+        const auto key = cpu.state.key_latch;
+
+        if ( key == eci_key_undefined )
+            return eci_key_pending;
+
+        cpu.state.key_latch = eci_key_undefined;
+
+        return key;
+    }
+
     uint8_t exec_get_key_random(
         const uint16_t instruction,
         const chip8_cpu_manager_unit& cpu,
         const chip8_memory_manager_unit& mmu
     ) {
-        return rand( ) % eci_key_count;
+        return cpu.next_random( ) % eci_key_count;
     }
 
 };
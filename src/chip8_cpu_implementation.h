@@ -1,6 +1,6 @@
 #pragma once
 
-#include "chip8_cmu.h"
+#include "chip8_movie.h"
 
 struct chip8_cpu_manager_unit;
 
@@ -128,6 +128,12 @@ namespace chip8_cpu_implementation {
         const chip8_memory_manager_unit& mmu
     );
 
+    uint8_t exec_get_key_latch(
+        const uint16_t instruction,
+        const chip8_cpu_manager_unit& cpu,
+        const chip8_memory_manager_unit& mmu
+    );
+
     uint8_t exec_get_key_random(
         const uint16_t instruction,
         const chip8_cpu_manager_unit& cpu,
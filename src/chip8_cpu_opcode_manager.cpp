@@ -1,11 +1,27 @@
 #include "chip8.h"
 
+#ifdef CHIP8_OPCODE_STATS
+#   if defined( _M_X64 ) || defined( _M_IX86 )
+#       include <intrin.h>
+#       define CHIP8_STATS_TICKS( ) uint64_t( __rdtsc( ) )
+#       define CHIP8_STATS_UNIT "rdtsc"
+#   elif defined( __x86_64__ ) || defined( __i386__ )
+#       include <x86intrin.h>
+#       define CHIP8_STATS_TICKS( ) uint64_t( __rdtsc( ) )
+#       define CHIP8_STATS_UNIT "rdtsc"
+#   else
+#       define CHIP8_STATS_TICKS( ) uint64_t( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now( ).time_since_epoch( ) ).count( ) )
+#       define CHIP8_STATS_UNIT "ns"
+#   endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 chip8_cpu_opcode_manager::chip8_cpu_opcode_manager( )
 {
     initialize( );
+    reset_stats( );
 }
 
 void chip8_cpu_opcode_manager::set(
@@ -28,6 +44,26 @@ echip8_states chip8_cpu_opcode_manager::execute(
 ) {
     const auto instruction_opcode = uint16_t( instruction >> 12 );
 
+#ifdef CHIP8_OPCODE_STATS
+    stats.counts[ get_stats_key( instruction ) ] += 1;
+
+    auto& countdown = stats.countdowns[ instruction_opcode ];
+
+    if ( countdown > 1 )
+        countdown -= 1;
+    else {
+        countdown = next_sample_interval( );
+
+        const auto start_ticks = CHIP8_STATS_TICKS( );
+        const auto exec_state  = std::invoke( opcodes[ instruction_opcode ].exec, instruction, cpu, mmu, smu );
+
+        stats.ticks[ instruction_opcode ]   += CHIP8_STATS_TICKS( ) - start_ticks;
+        stats.samples[ instruction_opcode ] += 1;
+
+        return exec_state;
+    }
+#endif
+
     return std::invoke( opcodes[ instruction_opcode ].exec, instruction, cpu, mmu, smu );
 }
 
@@ -40,6 +76,98 @@ void chip8_cpu_opcode_manager::dump( ) const {
         printf( "[ 0x%02X ] %s\n", opcode_id++, opcode.name );
 }
 
+void chip8_cpu_opcode_manager::reset_stats( ) {
+#ifdef CHIP8_OPCODE_STATS
+    stats      = { };
+    stats.seed = 0x9E3779B9;
+
+    for ( auto& countdown : stats.countdowns )
+        countdown = next_sample_interval( );
+#endif
+}
+
+void chip8_cpu_opcode_manager::dump_stats( ) const {
+#ifdef CHIP8_OPCODE_STATS
+    printf( "> Opcode Statistics : about 1/%u per family timed, " CHIP8_STATS_UNIT " ticks\n", SampleRate );
+
+    for ( auto opcode = uint16_t( 0 ); opcode < Count; opcode++ ) {
+        auto family_count = uint64_t( 0 );
+
+        for ( auto sub_opcode = uint16_t( 0 ); sub_opcode < 256; sub_opcode++ )
+            family_count += stats.counts[ ( opcode << 8 ) | sub_opcode ];
+
+        if ( family_count == 0 )
+            continue;
+
+        const auto samples = stats.samples[ opcode ];
+        const auto ticks   = samples > 0 ? double( stats.ticks[ opcode ] ) / double( samples ) : 0.0;
+
+        printf( "[ 0x%X ] %-16s %12" PRIu64 " %10.1f\n", opcode, opcodes[ opcode ].name, family_count, ticks );
+
+        for ( auto sub_opcode = uint16_t( 0 ); sub_opcode < 256; sub_opcode++ ) {
+            const auto key = uint16_t( ( opcode << 8 ) | sub_opcode );
+
+            if ( stats.counts[ key ] > 0 )
+                printf( "  %s %12" PRIu64 "\n", get_stats_name( key ).c_str( ), stats.counts[ key ] );
+        }
+    }
+#else
+    printf( "> Opcode Statistics : disabled, build with CHIP8_OPCODE_STATS\n" );
+#endif
+}
+
+bool chip8_cpu_opcode_manager::write_stats( [[maybe_unused]] chip8_string stats_path ) const {
+#ifdef CHIP8_OPCODE_STATS
+    auto* stats_file = fopen( stats_path, "w" );
+
+    if ( !stats_file )
+        return false;
+
+    fprintf( stats_file, "{\n  \"sample_rate\": %u,\n  \"tick_unit\": \"" CHIP8_STATS_UNIT "\",\n", SampleRate );
+    fprintf( stats_file, "  \"families\": [" );
+
+    auto separator = "";
+
+    for ( auto opcode = uint16_t( 0 ); opcode < Count; opcode++ ) {
+        auto family_count = uint64_t( 0 );
+
+        for ( auto sub_opcode = uint16_t( 0 ); sub_opcode < 256; sub_opcode++ )
+            family_count += stats.counts[ ( opcode << 8 ) | sub_opcode ];
+
+        fprintf( 
+            stats_file, 
+            "%s\n    { \"family\": \"%X\", \"name\": \"%s\", \"count\": %" PRIu64 ", \"samples\": %" PRIu64 ", \"ticks\": %" PRIu64 " }",
+            separator, opcode, opcodes[ opcode ].name, family_count, stats.samples[ opcode ], stats.ticks[ opcode ]
+        );
+
+        separator = ",";
+    }
+
+    fprintf( stats_file, "\n  ],\n  \"opcodes\": [" );
+
+    separator = "";
+
+    for ( auto key = uint16_t( 0 ); key < stats.counts.size( ); key++ ) {
+        if ( stats.counts[ key ] == 0 )
+            continue;
+
+        fprintf( 
+            stats_file, 
+            "%s\n    { \"opcode\": \"%s\", \"count\": %" PRIu64 " }",
+            separator, get_stats_name( key ).c_str( ), stats.counts[ key ]
+        );
+
+        separator = ",";
+    }
+
+    fprintf( stats_file, "\n  ]\n}\n" );
+
+    return fclose( stats_file ) == 0;
+#else
+    return false;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PRIVATE ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +188,77 @@ void chip8_cpu_opcode_manager::initialize( ) {
         opcode.exec = exec_unimplemented;
 }
 
+#ifdef CHIP8_OPCODE_STATS
+uint32_t chip8_cpu_opcode_manager::next_sample_interval( ) {
+    // Xorshift32, mean interval stay the sample rate.
+    stats.seed ^= stats.seed << 13;
+    stats.seed ^= stats.seed >> 17;
+    stats.seed ^= stats.seed << 5;
+
+    return 1 + stats.seed % ( 2 * SampleRate - 1 );
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint16_t chip8_cpu_opcode_manager::get_stats_key( const uint16_t instruction ) {
+    const auto opcode         = uint16_t( instruction >> 12 );
+    const auto instruction_nn = uint16_t( instruction & 0x00FF );
+    auto sub_opcode           = uint16_t( 0 );
+
+    switch ( opcode ) {
+        case 0x0 :
+            if ( instruction == 0x00E0 || instruction == 0x00EE )
+                sub_opcode = instruction_nn;
+            break;
+
+        case 0x8 : sub_opcode = instruction & 0x000F; break;
+        case 0xE :
+        case 0xF : sub_opcode = instruction_nn;       break;
+
+        default : break;
+    }
+
+    return uint16_t( ( opcode << 8 ) | sub_opcode );
+}
+
+std::string chip8_cpu_opcode_manager::get_stats_name( const uint16_t key ) {
+    static constexpr chip8_string Patterns[ Count ] = {
+        "0NNN", "1NNN", "2NNN", "3XNN", "4XNN", "5XY0", "6XNN", "7XNN",
+        "8XYN", "9XY0", "ANNN", "BNNN", "CXNN", "DXYN", "EXNN", "FXNN"
+    };
+
+    const auto opcode     = uint8_t( key >> 8 );
+    const auto sub_opcode = uint8_t( key & 0xFF );
+    auto name             = std::string( Patterns[ opcode ] );
+    auto buffer           = std::array<char, 8>{ };
+
+    switch ( opcode ) {
+        case 0x0 :
+            if ( sub_opcode != 0 ) {
+                snprintf( buffer.data( ), buffer.size( ), "00%02X", sub_opcode );
+                name = buffer.data( );
+            }
+            break;
+
+        case 0x8 :
+            snprintf( buffer.data( ), buffer.size( ), "8XY%X", sub_opcode );
+            name = buffer.data( );
+            break;
+
+        case 0xE :
+        case 0xF :
+            snprintf( buffer.data( ), buffer.size( ), "%XX%02X", opcode, sub_opcode );
+            name = buffer.data( );
+            break;
+
+        default : break;
+    }
+
+    return name;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,24 @@ using chip8_opcode = std::function<echip8_states(
     chip8_screen_manager_unit&
 )>;
 
+/**
+ * Define opcode execution statistics, only collected when built
+ * with CHIP8_OPCODE_STATS.
+ * @field counts : Execution count per opcode and sub-opcode key.
+ * @field ticks : Sampled host ticks per opcode family.
+ * @field samples : Timed execution count per opcode family.
+ * @field countdowns : Executions left before next timed one, per
+ *                    opcode family.
+ * @field seed : Random sample interval generator state.
+ **/
+struct chip8_opcode_stats {
+    std::array<uint64_t, 16 * 256> counts;
+    std::array<uint64_t, 16> ticks;
+    std::array<uint64_t, 16> samples;
+    std::array<uint32_t, 16> countdowns;
+    uint32_t seed;
+};
+
 /**
  * chip8_cpu_opcode_manager class
  * @note Store and manage opcocdes.
@@ -24,6 +42,14 @@ class chip8_cpu_opcode_manager final {
 
     static constexpr uint8_t Count = 16;
     static constexpr chip8_string Unnamed = "~unnamed";
+    static constexpr uint32_t SampleRate = 64;
+
+public:
+#ifdef CHIP8_OPCODE_STATS
+    static constexpr bool HasStats = true;
+#else
+    static constexpr bool HasStats = false;
+#endif
 
     /**
      * 
@@ -36,6 +62,9 @@ class chip8_cpu_opcode_manager final {
 
 private:
     std::array<chip8_cpu_opcode, Count> opcodes;
+#ifdef CHIP8_OPCODE_STATS
+    chip8_opcode_stats stats;
+#endif
 
 public:
     /**
@@ -78,6 +107,27 @@ public:
      **/
     void dump( ) const;
 
+    /**
+     * reset_stats method
+     * @note Clear opcode execution statistics.
+     **/
+    void reset_stats( );
+
+    /**
+     * dump_stats method
+     * @note Dump execution count per sub-opcode and sampled host
+     *       ticks per opcode family.
+     **/
+    void dump_stats( ) const;
+
+    /**
+     * write_stats function
+     * @note Write opcode execution statistics as JSON.
+     * @param stats_path : Target JSON file path.
+     * @return True when statistics were written.
+     **/
+    bool write_stats( [[maybe_unused]] chip8_string stats_path ) const;
+
 private:
     /**
      * initialize method
@@ -85,6 +135,36 @@ private:
      **/
     void initialize( );
 
+#ifdef CHIP8_OPCODE_STATS
+    /**
+     * next_sample_interval function
+     * @note Get a random execution count before next timed one,
+     *       between 1 and twice the sample rate so loops whose
+     *       length divide the rate don't always time the same
+     *       instruction.
+     * @return Execution count.
+     **/
+    uint32_t next_sample_interval( );
+#endif
+
+private:
+    /**
+     * get_stats_key function
+     * @note Get statistics key of an instruction, family in high
+     *       byte and sub-opcode in low byte for 0, 8, E and F.
+     * @param instruction : Target instruction.
+     * @return Statistics key.
+     **/
+    static uint16_t get_stats_key( const uint16_t instruction );
+
+    /**
+     * get_stats_name function
+     * @note Get printable sub-opcode name of a statistics key.
+     * @param key : Target statistics key.
+     * @return Sub-opcode name like 8XY4 or FX33.
+     **/
+    static std::string get_stats_name( const uint16_t key );
+
 public:
     /**
      * get_name function
@@ -3,34 +3,46 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
-chip8_cpu_option_manager::chip8_cpu_option_manager( )
-    : options{ 
+chip8_cpu_option_manager::chip8_cpu_option_manager( chip8_hot_state& hot_state )
+    : state{ hot_state },
+    names{ 
         "use_legacy", 
         "use_print",
         "use_stack_limit",
-        "use_limit"
+        "use_limit",
+        "use_virtual_timers",
+        "use_idle_skip",
+        "use_display_wait"
     }
 { 
     set( ecc_option_limit, true );
+    set( ecc_option_idle, true );
 }
 
 void chip8_cpu_option_manager::set(
     const echip8_cpu_options option,
     const bool value
 ) {
-    options[ uint8_t( option ) ].value = value;
+    const auto option_bit = uint8_t( 1 << uint8_t( option ) );
+
+    if ( value )
+        state.flags |= option_bit;
+    else
+        state.flags &= ~option_bit;
 }
 
 void chip8_cpu_option_manager::dump( ) const {
-    for ( const auto option : options )
-        printf( "%s = %d\n", option.name, option.value );
+    auto option_id = 0;
+
+    for ( const auto* name : names )
+        printf( "%s = %d\n", name, get( echip8_cpu_options( option_id++ ) ) );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 bool chip8_cpu_option_manager::get( const echip8_cpu_options option ) const {
-    return options[ uint8_t( option ) ].value;
+    return ( state.flags >> uint8_t( option ) ) & 0x01;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
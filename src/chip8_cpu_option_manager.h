@@ -4,38 +4,21 @@
 
 /**
  * chip8_cpu_option_manager class 
- * @note Store and manage cpu options.
+ * @note Manage cpu options, option values are stored as bits
+ *       of the machine hot state flags.
  **/
 class chip8_cpu_option_manager final {
 
-    /**
-     * chip8_cpu_option struct
-     * @note Define a record for option storage.
-     **/
-    struct chip8_cpu_option {
-
-        chip8_string name;
-        bool value;
-
-        /**
-         * Constructor
-         * @param option_name: Target option name.
-         **/
-        chip8_cpu_option( chip8_string option_name )
-            : name{ option_name },
-            value{ false }
-        { };
-
-    };
-
 private:
-    std::array<chip8_cpu_option, ecc_option_count> options;
+    chip8_hot_state& state;
+    std::array<chip8_string, ecc_option_count> names;
 
 public:
     /**
      * Constructor 
+     * @param hot_state : Reference to machine hot state.
      **/
-    chip8_cpu_option_manager( );
+    chip8_cpu_option_manager( chip8_hot_state& hot_state );
 
     /**
      * set method
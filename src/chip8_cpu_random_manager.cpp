@@ -0,0 +1,122 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_cpu_random_manager::chip8_cpu_random_manager( )
+    : state{ { }, DefaultSeed, ecr_xoshiro }
+{
+    reset( );
+}
+
+void chip8_cpu_random_manager::reset( ) {
+    auto mix = state.seed;
+
+    switch ( state.mode ) {
+        case ecr_pcg :
+            state.words      = { };
+            state.words[ 1 ] = ( split_mix( mix ) << 1 ) | 1;
+
+            next_pcg( );
+
+            state.words[ 0 ] += state.seed;
+
+            next_pcg( );
+            break;
+
+        case ecr_system :
+            std::srand( uint32_t( state.seed ) );
+            break;
+
+        default :
+            for ( auto& word : state.words )
+                word = split_mix( mix );
+            break;
+    }
+}
+
+void chip8_cpu_random_manager::set_seed( const uint64_t seed ) {
+    state.seed = seed;
+
+    reset( );
+}
+
+void chip8_cpu_random_manager::set_mode( const echip8_random_modes mode ) {
+    state.mode = mode;
+
+    reset( );
+}
+
+uint32_t chip8_cpu_random_manager::next( ) {
+    switch ( state.mode ) {
+        case ecr_pcg    : return next_pcg( );
+        case ecr_system : return uint32_t( std::rand( ) );
+
+        default : break;
+    }
+
+    return uint32_t( next_xoshiro( ) >> 32 );
+}
+
+void chip8_cpu_random_manager::save_state( chip8_machine_state& machine_state ) const {
+    machine_state.random = state;
+}
+
+void chip8_cpu_random_manager::load_state( const chip8_machine_state& machine_state ) {
+    state = machine_state.random;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t chip8_cpu_random_manager::next_xoshiro( ) {
+    auto& words = state.words;
+
+    const auto result = std::rotl( words[ 1 ] * 5, 7 ) * 9;
+    const auto shift  = words[ 1 ] << 17;
+
+    words[ 2 ] ^= words[ 0 ];
+    words[ 3 ] ^= words[ 1 ];
+    words[ 1 ] ^= words[ 2 ];
+    words[ 0 ] ^= words[ 3 ];
+    words[ 2 ] ^= shift;
+    words[ 3 ]  = std::rotl( words[ 3 ], 45 );
+
+    return result;
+}
+
+uint32_t chip8_cpu_random_manager::next_pcg( ) {
+    const auto old_state = state.words[ 0 ];
+
+    state.words[ 0 ] = old_state * 6364136223846993005ULL + state.words[ 1 ];
+
+    const auto xorshifted = uint32_t( ( ( old_state >> 18 ) ^ old_state ) >> 27 );
+    const auto rotation   = int( old_state >> 59 );
+
+    return std::rotr( xorshifted, rotation );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t chip8_cpu_random_manager::split_mix( uint64_t& value ) {
+    value += 0x9E3779B97F4A7C15ULL;
+
+    auto result = value;
+
+    result = ( result ^ ( result >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    result = ( result ^ ( result >> 27 ) ) * 0x94D049BB133111EBULL;
+
+    return result ^ ( result >> 31 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint64_t chip8_cpu_random_manager::get_seed( ) const {
+    return state.seed;
+}
+
+echip8_random_modes chip8_cpu_random_manager::get_mode( ) const {
+    return echip8_random_modes( state.mode );
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "chip8_cpu_option_manager.h"
+
+/**
+ * Define random generator state, trivially copyable for save states.
+ * @field words : Generator state words, PCG32 use the first two.
+ * @field seed : Seed used on reset.
+ * @field mode : Generator mode from echip8_random_modes.
+ **/
+struct chip8_random_state {
+    std::array<uint64_t, 4> words;
+    uint64_t seed;
+    uint8_t mode;
+};
+
+/**
+ * chip8_cpu_random_manager class
+ * @note Per machine seedable random generator, replace the shared
+ *       C rand state so machines never contend and runs can be
+ *       replayed from a seed.
+ **/
+class chip8_cpu_random_manager final {
+
+public:
+    static constexpr uint64_t DefaultSeed = 0x43484950382D5247;
+
+private:
+    chip8_random_state state;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_cpu_random_manager( );
+
+    /**
+     * reset method
+     * @note Restart the sequence from current seed.
+     **/
+    void reset( );
+
+    /**
+     * set_seed method
+     * @note Set seed and restart the sequence.
+     * @param seed : Target seed.
+     **/
+    void set_seed( const uint64_t seed );
+
+    /**
+     * set_mode method
+     * @note Set generator mode and restart the sequence.
+     * @param mode : Target generator mode.
+     **/
+    void set_mode( const echip8_random_modes mode );
+
+    /**
+     * next function
+     * @note Get next random value.
+     * @return Random value.
+     **/
+    uint32_t next( );
+
+    /**
+     * save_state method
+     * @note Copy generator state to a machine state.
+     * @param machine_state : Target machine state.
+     **/
+    void save_state( chip8_machine_state& machine_state ) const;
+
+    /**
+     * load_state method
+     * @note Copy generator state from a machine state.
+     * @param machine_state : Source machine state.
+     **/
+    void load_state( const chip8_machine_state& machine_state );
+
+private:
+    /**
+     * next_xoshiro function
+     * @note Step xoshiro256** generator.
+     * @return Random value.
+     **/
+    uint64_t next_xoshiro( );
+
+    /**
+     * next_pcg function
+     * @note Step PCG32 XSH RR generator.
+     * @return Random value.
+     **/
+    uint32_t next_pcg( );
+
+private:
+    /**
+     * split_mix function
+     * @note Step splitmix64, used to expand the seed.
+     * @param value : Target splitmix state.
+     * @return Random value.
+     **/
+    static uint64_t split_mix( uint64_t& value );
+
+public:
+    /**
+     * get_seed function
+     * @note Get current seed.
+     * @return Current seed.
+     **/
+    uint64_t get_seed( ) const;
+
+    /**
+     * get_mode function
+     * @note Get generator mode.
+     * @return Generator mode.
+     **/
+    echip8_random_modes get_mode( ) const;
+
+};
@@ -3,43 +3,53 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
-chip8_cpu_timer_manager::chip8_cpu_timer_manager( )
+chip8_cpu_timer_manager::chip8_cpu_timer_manager( chip8_hot_state& hot_state )
+    : state{ hot_state },
+    user_make_noise{ },
+    audio{ },
+    ticks{ 0 }
 { 
     reset( ); 
 }
 
-
 void chip8_cpu_timer_manager::set_make_noise( chip8_make_noise_callback&& callback ) {
     user_make_noise = std::move( callback );
 }
 
 void chip8_cpu_timer_manager::reset( ) {
-    delay_timer = 60;
-    sound_timer = 60;
+    set_delay( 60 );
+    set_sound( 60 );
 }
 
 void chip8_cpu_timer_manager::set_delay( const uint8_t value ) {
-    delay_timer = value;
+    std::atomic_ref<uint8_t>( state.delay_timer ).store( value );
 }
 
 void chip8_cpu_timer_manager::set_sound( const uint8_t value ) {
-    sound_timer = value;
+    std::atomic_ref<uint8_t>( state.sound_timer ).store( value );
 }
 
-void chip8_cpu_timer_manager::update( ) {
-    if ( delay_timer > 0 )
-        delay_timer -= 1;
+void chip8_cpu_timer_manager::update( const uint64_t cycle ) {
+    ticks.fetch_add( 1, std::memory_order_relaxed );
 
-    if ( sound_timer > 0 ) {
-        sound_timer -= 1;
+    decrement( state.delay_timer );
 
-        invoke_make_noise( );
-    }
+    const auto is_sounding = decrement( state.sound_timer );
+
+    audio.generate( is_sounding );
+
+    auto& events = chip8_event_trace::get( );
+
+    if ( events.is_enabled( ) )
+        events.instant( "timer_tick", "timer", cycle, get_delay( ) | ( get_sound( ) << 8 ) );
+
+    if ( is_sounding )
+        invoke_make_noise( cycle );
 }
 
 void chip8_cpu_timer_manager::dump( ) const {
-    const auto delay_value = delay_timer.load( );
-    const auto sound_value = sound_timer.load( );
+    const auto delay_value = get_delay( );
+    const auto sound_value = get_sound( );
 
     printf( "Delay Timer %3d\nSound Timer %3d\n", delay_value, sound_value );
 }
@@ -47,10 +57,24 @@ void chip8_cpu_timer_manager::dump( ) const {
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PRIVATE ===
 ////////////////////////////////////////////////////////////////////////////////////////////
-void chip8_cpu_timer_manager::invoke_make_noise( ) {
+bool chip8_cpu_timer_manager::decrement( uint8_t& timer ) {
+    auto timer_ref = std::atomic_ref<uint8_t>( timer );
+    auto value     = timer_ref.load( );
+
+    while ( value > 0 ) {
+        if ( timer_ref.compare_exchange_weak( value, uint8_t( value - 1 ) ) )
+            return true;
+    }
+
+    return false;
+}
+
+void chip8_cpu_timer_manager::invoke_make_noise( const uint64_t cycle ) {
     if ( !user_make_noise )
         return;
 
+    auto noise_scope = chip8_event_scope{ "make_noise", "callback", cycle };
+
     std::invoke( user_make_noise );
 }
 
@@ -58,9 +82,17 @@ void chip8_cpu_timer_manager::invoke_make_noise( ) {
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 uint8_t chip8_cpu_timer_manager::get_delay( ) const {
-    return delay_timer;
+    return std::atomic_ref<uint8_t>( state.delay_timer ).load( );
 }
 
 uint8_t chip8_cpu_timer_manager::get_sound( ) const {
-    return sound_timer;
+    return std::atomic_ref<uint8_t>( state.sound_timer ).load( );
+}
+
+chip8_audio_manager& chip8_cpu_timer_manager::get_audio( ) {
+    return audio;
+}
+
+uint64_t chip8_cpu_timer_manager::get_ticks( ) const {
+    return ticks.load( std::memory_order_relaxed );
 }
@@ -1,23 +1,27 @@
 #pragma once
 
-#include "chip8_smu.h"
+#include "chip8_audio_manager.h"
 
 /**
  * chip8_cpu_timer_manager class
- * @note Store and manage chip8 timers.
+ * @note Manage chip8 timers, timer values live in the machine
+ *       hot state and are accessed atomically. Each update feed
+ *       one tick of sound timer to the audio manager.
  **/
 class chip8_cpu_timer_manager final {
 
 private:
-    std::atomic<uint8_t> delay_timer;
-    std::atomic<uint8_t> sound_timer;
+    chip8_hot_state& state;
     chip8_make_noise_callback user_make_noise;
+    chip8_audio_manager audio;
+    std::atomic<uint64_t> ticks;
 
 public:
     /**
      * Constructor
+     * @param hot_state : Reference to machine hot state.
      **/
-    chip8_cpu_timer_manager( );
+    chip8_cpu_timer_manager( chip8_hot_state& hot_state );
 
     /**
      * set_make_noise method
@@ -49,8 +53,11 @@ public:
     /**
      * update method
      * @note Update delay and sound timers.
+     * @param cycle : Executed instruction count for the event trace,
+     *                0 from the timer service thread that can't read
+     *                it.
      **/
-    void update( );
+    void update( const uint64_t cycle );
 
     /**
      * dump method
@@ -59,11 +66,20 @@ public:
     void dump( ) const;
 
 private:
+    /**
+     * decrement function
+     * @note Atomically decrement a timer when not zero.
+     * @param timer : Target timer value.
+     * @return True when the timer was decremented.
+     **/
+    bool decrement( uint8_t& timer );
+
     /**
      * invoke_make_noise method
      * @note Proxy for invoking make noise callback.
+     * @param cycle : Executed instruction count for the event trace.
      **/
-    void invoke_make_noise( );
+    void invoke_make_noise( const uint64_t cycle );
 
 public:
     /**
@@ -80,4 +96,19 @@ public:
      **/
     uint8_t get_sound( ) const;
 
+    /**
+     * get_audio function
+     * @note Get reference to audio manager.
+     * @return Reference to audio manager.
+     **/
+    chip8_audio_manager& get_audio( );
+
+    /**
+     * get_ticks function
+     * @note Get timer update count, updates may come from the
+     *       timer service thread.
+     * @return Timer update count.
+     **/
+    uint64_t get_ticks( ) const;
+
 };
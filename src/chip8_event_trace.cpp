@@ -0,0 +1,150 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_event_trace::chip8_event_trace( )
+    : is_running{ false },
+    buffers_mutex{ },
+    buffers{ },
+    origin{ 0 }
+{
+    origin = now( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_event_trace::enable( ) {
+    is_running.store( true, std::memory_order_release );
+}
+
+void chip8_event_trace::disable( ) {
+    is_running.store( false, std::memory_order_release );
+}
+
+void chip8_event_trace::clear( ) {
+    auto lock = std::lock_guard<std::mutex>{ buffers_mutex };
+
+    for ( auto& buffer : buffers ) {
+        auto buffer_lock = std::lock_guard<std::mutex>{ buffer->mutex };
+
+        buffer->events.clear( );
+    }
+
+    origin = now( );
+}
+
+void chip8_event_trace::complete(
+    chip8_string name,
+    chip8_string category,
+    const int64_t start,
+    const uint64_t cycle,
+    const uint32_t value
+) {
+    auto& buffer = get_buffer( );
+    auto lock    = std::lock_guard<std::mutex>{ buffer.mutex };
+
+    buffer.events.push_back( { name, category, start, now( ) - start, cycle, value, 'X' } );
+}
+
+void chip8_event_trace::instant(
+    chip8_string name,
+    chip8_string category,
+    const uint64_t cycle,
+    const uint32_t value
+) {
+    auto& buffer = get_buffer( );
+    auto lock    = std::lock_guard<std::mutex>{ buffer.mutex };
+
+    buffer.events.push_back( { name, category, now( ), 0, cycle, value, 'i' } );
+}
+
+bool chip8_event_trace::write( chip8_string trace_path ) {
+    auto* trace_file = fopen( trace_path, "w" );
+
+    if ( !trace_file )
+        return false;
+
+    auto lock      = std::lock_guard<std::mutex>{ buffers_mutex };
+    auto events    = std::vector<chip8_trace_event>{ };
+    auto separator = "";
+
+    fprintf( trace_file, "{\n  \"displayTimeUnit\": \"ns\",\n  \"traceEvents\": [" );
+
+    for ( const auto& buffer : buffers ) {
+        fprintf(
+            trace_file,
+            "%s\n    { \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %u, \"args\": { \"name\": \"chip8 %u\" } }",
+            separator, buffer->thread_id, buffer->thread_id
+        );
+
+        separator = ",";
+
+        {
+            auto buffer_lock = std::lock_guard<std::mutex>{ buffer->mutex };
+
+            events = buffer->events;
+        }
+
+        for ( const auto& event : events ) {
+            // Chrome trace time unit is the microsecond.
+            const auto timestamp = double( event.timestamp - origin ) / 1000.0;
+
+            fprintf(
+                trace_file,
+                ",\n    { \"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"%c\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f",
+                event.name, event.category, event.phase, buffer->thread_id, timestamp
+            );
+
+            if ( event.phase == 'X' )
+                fprintf( trace_file, ", \"dur\": %.3f", double( event.duration ) / 1000.0 );
+            else
+                fprintf( trace_file, ", \"s\": \"t\"" );
+
+            fprintf( trace_file, ", \"args\": { \"cycle\": %" PRIu64 ", \"value\": %u } }", event.cycle, event.value );
+        }
+    }
+
+    fprintf( trace_file, "\n  ]\n}\n" );
+
+    return fclose( trace_file ) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_event_buffer& chip8_event_trace::get_buffer( ) {
+    thread_local auto* buffer = (chip8_event_buffer*)nullptr;
+
+    if ( !buffer ) {
+        auto lock = std::lock_guard<std::mutex>{ buffers_mutex };
+
+        buffers.emplace_back( std::make_unique<chip8_event_buffer>( ) );
+
+        buffer            = buffers.back( ).get( );
+        buffer->thread_id = uint32_t( buffers.size( ) );
+    }
+
+    return *buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_event_trace::is_enabled( ) const {
+    return is_running.load( std::memory_order_relaxed );
+}
+
+int64_t chip8_event_trace::now( ) const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>( clock_t::now( ).time_since_epoch( ) ).count( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_event_trace& chip8_event_trace::get( ) {
+    static auto trace = chip8_event_trace{ };
+
+    return trace;
+}
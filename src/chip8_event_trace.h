@@ -0,0 +1,231 @@
+#pragma once
+
+#include "chip8_globals.h"
+
+/**
+ * Define a trace event.
+ * @field name : Event name, must outlive the trace.
+ * @field category : Event category, must outlive the trace.
+ * @field timestamp : Wall clock start time in nanoseconds.
+ * @field duration : Wall clock duration in nanoseconds, 0 for instant.
+ * @field cycle : Executed instruction count, emulated time.
+ * @field value : Event specific value, like batch size.
+ * @field phase : Chrome trace phase, 'X' complete or 'i' instant.
+ **/
+struct chip8_trace_event {
+    chip8_string name;
+    chip8_string category;
+    int64_t timestamp;
+    int64_t duration;
+    uint64_t cycle;
+    uint32_t value;
+    char phase;
+};
+
+/**
+ * Define emulation events spanning several instructions.
+ * @field frame_start : Current emulated frame wall clock start.
+ * @field frame_cycle : Current emulated frame first instruction.
+ * @field draw_start : Current DXYN batch wall clock start.
+ * @field draw_cycle : Current DXYN batch first instruction.
+ * @field draw_count : Current DXYN batch size, 0 when none.
+ **/
+struct chip8_event_batch {
+    int64_t frame_start;
+    uint64_t frame_cycle;
+    int64_t draw_start;
+    uint64_t draw_cycle;
+    uint32_t draw_count;
+};
+
+/**
+ * Define a per thread event buffer.
+ * @note The mutex is only contended while clear or write visit
+ *       the buffer.
+ * @field thread_id : Buffer thread index, Chrome trace tid.
+ * @field mutex : Guard events against clear and write.
+ * @field events : Buffered events.
+ **/
+struct chip8_event_buffer {
+    uint32_t thread_id;
+    std::mutex mutex;
+    std::vector<chip8_trace_event> events;
+};
+
+/**
+ * chip8_event_trace class
+ * @note Process wide Chrome trace-event recorder. Each thread append
+ *       to its own buffer under the buffer lock, uncontended while
+ *       recording, buffers are written as JSON for chrome://tracing
+ *       or Perfetto.
+ **/
+class chip8_event_trace final {
+
+    using clock_t = std::chrono::steady_clock;
+
+private:
+    std::atomic<bool> is_running;
+    std::mutex buffers_mutex;
+    std::vector<std::unique_ptr<chip8_event_buffer>> buffers;
+    int64_t origin;
+
+private:
+    /**
+     * Constructor
+     * @note Trace is only reachable through get.
+     **/
+    chip8_event_trace( );
+
+public:
+    /**
+     * Copy-Constructor
+     * @note Trace is unique to the process.
+     **/
+    chip8_event_trace( const chip8_event_trace& ) = delete;
+
+    /**
+     * enable method
+     * @note Start recording events, previous events are kept.
+     **/
+    void enable( );
+
+    /**
+     * disable method
+     * @note Stop recording events.
+     **/
+    void disable( );
+
+    /**
+     * clear method
+     * @note Drop recorded events, threads may keep recording.
+     **/
+    void clear( );
+
+    /**
+     * complete method
+     * @note Record an event from start up to now.
+     * @param name : Event name.
+     * @param category : Event category.
+     * @param start : Event wall clock start, from now.
+     * @param cycle : Executed instruction count at event start.
+     * @param value : Event specific value.
+     **/
+    void complete(
+        chip8_string name,
+        chip8_string category,
+        const int64_t start,
+        const uint64_t cycle,
+        const uint32_t value = 0
+    );
+
+    /**
+     * instant method
+     * @note Record an instant event.
+     * @param name : Event name.
+     * @param category : Event category.
+     * @param cycle : Executed instruction count.
+     * @param value : Event specific value.
+     **/
+    void instant(
+        chip8_string name,
+        chip8_string category,
+        const uint64_t cycle,
+        const uint32_t value = 0
+    );
+
+    /**
+     * write function
+     * @note Write every thread events as Chrome trace-event JSON,
+     *       threads may keep recording. Each buffer is copied under
+     *       its lock and formatted outside it, so recording threads
+     *       never wait for the file.
+     * @param trace_path : Target JSON file path.
+     * @return True when the file was written.
+     **/
+    bool write( chip8_string trace_path );
+
+private:
+    /**
+     * get_buffer function
+     * @note Get calling thread buffer, created on first use.
+     * @return Reference to calling thread buffer.
+     **/
+    chip8_event_buffer& get_buffer( );
+
+public:
+    /**
+     * is_enabled function
+     * @note Get if events are recorded.
+     * @return True when recording.
+     **/
+    bool is_enabled( ) const;
+
+    /**
+     * now function
+     * @note Get wall clock time used by events.
+     * @return Steady clock time in nanoseconds.
+     **/
+    int64_t now( ) const;
+
+public:
+    /**
+     * get function
+     * @note Get process trace.
+     * @return Reference to process trace.
+     **/
+    static chip8_event_trace& get( );
+
+public:
+    /**
+     * operator=
+     * @note Trace is unique to the process.
+     **/
+    chip8_event_trace& operator=( const chip8_event_trace& ) = delete;
+
+};
+
+/**
+ * chip8_event_scope class
+ * @note Record a complete event for the scope lifetime when
+ *       the event trace is enabled.
+ **/
+class chip8_event_scope final {
+
+private:
+    chip8_string name;
+    chip8_string category;
+    int64_t start;
+    uint64_t cycle;
+
+public:
+    /**
+     * Constructor
+     * @param scope_name : Event name.
+     * @param scope_category : Event category.
+     * @param scope_cycle : Executed instruction count.
+     **/
+    chip8_event_scope(
+        chip8_string scope_name,
+        chip8_string scope_category,
+        const uint64_t scope_cycle
+    )
+        : name{ scope_name },
+        category{ scope_category },
+        start{ -1 },
+        cycle{ scope_cycle }
+    {
+        auto& events = chip8_event_trace::get( );
+
+        if ( events.is_enabled( ) )
+            start = events.now( );
+    };
+
+    /**
+     * Destructor
+     **/
+    ~chip8_event_scope( ) {
+        if ( start >= 0 )
+            chip8_event_trace::get( ).complete( name, category, start, cycle );
+    };
+
+};
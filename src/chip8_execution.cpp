@@ -0,0 +1,47 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_execution::chip8_execution( std::coroutine_handle<promise_type> coroutine )
+    : handle{ coroutine }
+{ }
+
+chip8_execution::chip8_execution( chip8_execution&& other ) noexcept
+    : handle{ std::exchange( other.handle, nullptr ) }
+{ }
+
+chip8_execution::~chip8_execution( ) {
+    if ( handle )
+        handle.destroy( );
+}
+
+echip8_suspends chip8_execution::resume( ) {
+    if ( done( ) )
+        return ecsp_done;
+
+    handle.resume( );
+
+    return handle.promise( ).suspend;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_execution::done( ) const {
+    return !handle || handle.done( );
+}
+
+echip8_suspends chip8_execution::get_suspend( ) const {
+    if ( !handle )
+        return ecsp_done;
+
+    return handle.promise( ).suspend;
+}
+
+echip8_states chip8_execution::get_state( ) const {
+    if ( !handle )
+        return ecs_nip;
+
+    return handle.promise( ).state;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "chip8_pacer.h"
+
+/**
+ * chip8_execution class
+ * @note Coroutine handle returned by chip8::run, execution is
+ *       started suspended and only progress when the host resume
+ *       it. A suspended execution hold no thread, so any number of
+ *       machines can be multiplexed on a small executor pool.
+ **/
+class chip8_execution final {
+
+public:
+    /**
+     * promise_type struct
+     * @note Coroutine promise, store last suspension reason and
+     *       final execution state.
+     **/
+    struct promise_type {
+
+        echip8_suspends suspend = ecsp_none;
+        echip8_states state     = ecs_run;
+
+        chip8_execution get_return_object( ) {
+            return chip8_execution{ std::coroutine_handle<promise_type>::from_promise( chip8_self ) };
+        };
+
+        std::suspend_always initial_suspend( ) noexcept { return { }; };
+
+        std::suspend_always final_suspend( ) noexcept { return { }; };
+
+        std::suspend_always yield_value( const echip8_suspends reason ) noexcept {
+            suspend = reason;
+
+            return { };
+        };
+
+        void return_value( const echip8_states exec_state ) noexcept {
+            suspend = ecsp_done;
+            state   = exec_state;
+        };
+
+        void unhandled_exception( ) { std::terminate( ); };
+
+    };
+
+private:
+    std::coroutine_handle<promise_type> handle;
+
+public:
+    /**
+     * Constructor
+     * @param coroutine : Coroutine handle to take ownership of.
+     **/
+    explicit chip8_execution( std::coroutine_handle<promise_type> coroutine );
+
+    /**
+     * Move-Constructor
+     * @param other : Target execution to take ownership of.
+     **/
+    chip8_execution( chip8_execution&& other ) noexcept;
+
+    /**
+     * Copy-Constructor
+     * @note Execution can't be copied.
+     **/
+    chip8_execution( const chip8_execution& ) = delete;
+
+    /**
+     * Destructor
+     **/
+    ~chip8_execution( );
+
+    /**
+     * resume function
+     * @note Run the machine until its next suspension, the host
+     *       must latch a key before resuming an ecsp_key suspension
+     *       or the resume count as a frame tick.
+     * @return Suspension reason, ecsp_done when execution ended.
+     **/
+    echip8_suspends resume( );
+
+public:
+    /**
+     * done function
+     * @note Get if execution ended.
+     * @return True when execution ended.
+     **/
+    bool done( ) const;
+
+    /**
+     * get_suspend function
+     * @note Get last suspension reason.
+     * @return Last suspension reason.
+     **/
+    echip8_suspends get_suspend( ) const;
+
+    /**
+     * get_state function
+     * @note Get execution state, ecs_run until execution ended.
+     * @return Execution state.
+     **/
+    echip8_states get_state( ) const;
+
+public:
+    /**
+     * operator=
+     * @note Execution can't be copied.
+     **/
+    chip8_execution& operator=( const chip8_execution& ) = delete;
+
+};
@@ -1,16 +1,29 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cinttypes>
 #include <chrono>
+#include <cmath>
+#include <coroutine>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <fstream>
-#include <stack>
+#include <string>
 #include <thread>
 #include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 /**
@@ -31,6 +44,25 @@
  **/
 using chip8_string = const char*;
 
+/**
+ * chip8_hash function
+ * @note FNV-1a 64 bits hash, used as content key for ROM and
+ *       screen buffers.
+ * @param data : Target buffer to hash.
+ * @param size : Target buffer size in bytes.
+ * @return Hash of the buffer content.
+ **/
+inline uint64_t chip8_hash( const uint8_t* data, const size_t size ) {
+    auto hash = uint64_t( 0xCBF29CE484222325 );
+
+    for ( auto byte_id = size_t( 0 ); byte_id < size; byte_id++ ) {
+        hash ^= data[ byte_id ];
+        hash *= uint64_t( 0x00000100000001B3 );
+    }
+
+    return hash;
+}
+
 /**
  * Define all possible state of the emulator
  **/
@@ -43,6 +75,29 @@ enum echip8_states : uint8_t {
     ecs_sgf, // Segmentation Fault
     ecs_iik, // Invalid Input Key
     ecs_epv, // End of Program with Value
+    ecs_hlt, // Halted, jump to self with timers at zero
+    ecs_wfk, // Waiting For Key, FX0A without pending key
+    ecs_ilr, // Instruction Limit Reached
+    ecs_brk, // Breakpoint Reached
+};
+
+/**
+ * Define all reasons for execution coroutine suspension.
+ **/
+enum echip8_suspends : uint8_t {
+    ecsp_none = 0,
+    ecsp_key,   // FX0A wait for a key
+    ecsp_frame, // Frame budget exhausted or vblank
+    ecsp_done   // Execution ended, state is final
+};
+
+/**
+ * Define all idle loops the interpreter can fast-forward.
+ **/
+enum echip8_idle_loops : uint8_t {
+    ecl_loop_none = 0,
+    ecl_loop_halt,  // 1NNN jump to self
+    ecl_loop_delay  // FX07; 3X00; 1NNN back to FX07
 };
 
 /**
@@ -73,7 +128,8 @@ enum echip8_addresses : uint16_t {
     eca_null       = 0x0000,
     eca_font_start = 0x0050,
     eca_font_stop  = 0x009F,
-    eca_rom_start  = 0x0200
+    eca_rom_start  = 0x0200,
+    eca_rom_stop   = 0x0FFF
 };
 
 /**
@@ -94,6 +150,9 @@ enum echip8_cpu_options : uint8_t {
     ecc_option_print,
     ecc_option_stack,
     ecc_option_limit,
+    ecc_option_virtual,
+    ecc_option_idle,
+    ecc_option_vblank,
     ecc_option_count
 };
 
@@ -118,6 +177,7 @@ enum echip8_input_keys : uint8_t {
     eci_key_E = 0x0E,
     eci_key_F = 0x0F,
     eci_key_count,
+    eci_key_pending = 0xFE,
     eci_key_undefined = 0xFF
 };
 
@@ -139,6 +199,32 @@ using chip8_get_key_callback = std::function<uint8_t(
  **/
 using chip8_make_noise_callback = std::function<void()>;
 
+/**
+ * Define all random generator modes.
+ **/
+enum echip8_random_modes : uint8_t {
+    ecr_xoshiro = 0, // xoshiro256**
+    ecr_pcg,         // PCG32 XSH RR
+    ecr_system       // C rand, shared global state
+};
+
+/**
+ * Define all movie modes.
+ **/
+enum echip8_movie_modes : uint8_t {
+    ecmv_none = 0,
+    ecmv_record, // Key events are recorded
+    ecmv_play    // Key events are replayed
+};
+
+/**
+ * Define all audio synthesis modes.
+ **/
+enum echip8_audio_modes : uint8_t {
+    ecam_square = 0, // Square wave at tone frequency
+    ecam_pattern     // XO-CHIP 128 bits pattern at pitch rate
+};
+
 /**
  * Define payload for sprite.
  * @field sprite : Target sprite to render.
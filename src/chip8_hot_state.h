@@ -0,0 +1,34 @@
+#pragma once
+
+#include "chip8_event_trace.h"
+
+/**
+ * Define the machine state touched by every instruction, packed
+ * in a single cache line. Units reference it instead of owning
+ * their own copy.
+ * @field V : Registers v0-vf.
+ * @field PC : CPU program counter.
+ * @field I : CPU index register.
+ * @field keys : Key state bitmask.
+ * @field SP : Call stack depth.
+ * @field delay_timer : Delay timer, updated with std::atomic_ref.
+ * @field sound_timer : Sound timer, updated with std::atomic_ref.
+ * @field flags : CPU options bitmask indexed by echip8_cpu_options.
+ * @field key_latch : Key pressed since last FX0A, eci_key_undefined when none.
+ * @field cycles : Executed instruction count.
+ **/
+struct alignas( 64 ) chip8_hot_state {
+    std::array<uint8_t, 16> V;
+    uint16_t PC;
+    uint16_t I;
+    uint16_t keys;
+    uint8_t SP;
+    uint8_t delay_timer;
+    uint8_t sound_timer;
+    uint8_t flags;
+    uint8_t key_latch;
+    uint64_t cycles;
+};
+
+static_assert( sizeof( chip8_hot_state ) == 64 );
+static_assert( std::is_trivially_copyable_v<chip8_hot_state> );
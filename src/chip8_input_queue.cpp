@@ -0,0 +1,67 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_input_queue::chip8_input_queue( )
+    : head{ 0 },
+    tail{ 0 },
+    events{ },
+    latency_max{ 0 },
+    dropped{ 0 }
+{ }
+
+bool chip8_input_queue::push( const uint8_t key, const bool pressed ) {
+    const auto tail_id = tail.load( std::memory_order_relaxed );
+
+    if ( tail_id - head.load( std::memory_order_acquire ) == Capacity ) {
+        dropped += 1;
+
+        return false;
+    }
+
+    const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>( clock_t::now( ).time_since_epoch( ) ).count( );
+
+    events[ tail_id & Mask ] = { now, key, pressed };
+
+    tail.store( tail_id + 1, std::memory_order_release );
+
+    return true;
+}
+
+bool chip8_input_queue::pop( chip8_input_event& event ) {
+    const auto head_id = head.load( std::memory_order_relaxed );
+
+    if ( head_id == tail.load( std::memory_order_acquire ) )
+        return false;
+
+    event = events[ head_id & Mask ];
+
+    head.store( head_id + 1, std::memory_order_release );
+
+    const auto now     = std::chrono::duration_cast<std::chrono::nanoseconds>( clock_t::now( ).time_since_epoch( ) ).count( );
+    const auto latency = now - event.timestamp;
+
+    latency_max = std::max( latency_max, latency );
+
+    return true;
+}
+
+void chip8_input_queue::clear( ) {
+    head.store( tail.load( std::memory_order_acquire ), std::memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_input_queue::empty( ) const {
+    return head.load( std::memory_order_relaxed ) == tail.load( std::memory_order_acquire );
+}
+
+int64_t chip8_input_queue::get_latency_max( ) const {
+    return latency_max;
+}
+
+uint64_t chip8_input_queue::get_dropped( ) const {
+    return dropped;
+}
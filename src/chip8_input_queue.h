@@ -0,0 +1,90 @@
+#pragma once
+
+#include "chip8_execution.h"
+
+/**
+ * Define a key event.
+ * @field timestamp : Event steady clock time in nanoseconds.
+ * @field key : Event key.
+ * @field pressed : True for key down, false for key up.
+ **/
+struct chip8_input_event {
+    int64_t timestamp;
+    uint8_t key;
+    bool pressed;
+};
+
+/**
+ * chip8_input_queue class
+ * @note Lock-free single producer single consumer ring of key
+ *       events. The host thread push events, the emulation thread
+ *       drain them at instruction boundaries, producer and consumer
+ *       indices live on their own cache line.
+ **/
+class chip8_input_queue final {
+
+    using clock_t = std::chrono::steady_clock;
+
+public:
+    static constexpr uint32_t Capacity = 256;
+    static constexpr uint32_t Mask     = Capacity - 1;
+
+private:
+    alignas( 64 ) std::atomic<uint32_t> head;
+    alignas( 64 ) std::atomic<uint32_t> tail;
+    alignas( 64 ) std::array<chip8_input_event, Capacity> events;
+    int64_t latency_max;
+    uint64_t dropped;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_input_queue( );
+
+    /**
+     * push function
+     * @note Push a key event, producer side only.
+     * @param key : Target key.
+     * @param pressed : True for key down, false for key up.
+     * @return False when the queue is full and the event dropped.
+     **/
+    bool push( const uint8_t key, const bool pressed );
+
+    /**
+     * pop function
+     * @note Pop oldest key event, consumer side only.
+     * @param event : Event output.
+     * @return True when an event was popped.
+     **/
+    bool pop( chip8_input_event& event );
+
+    /**
+     * clear method
+     * @note Drop all pending events, consumer side only.
+     **/
+    void clear( );
+
+public:
+    /**
+     * empty function
+     * @note Get if no event is pending.
+     * @return True when no event is pending.
+     **/
+    bool empty( ) const;
+
+    /**
+     * get_latency_max function
+     * @note Get largest time between an event push and its pop.
+     * @return Largest event latency in nanoseconds.
+     **/
+    int64_t get_latency_max( ) const;
+
+    /**
+     * get_dropped function
+     * @note Get event count dropped on full queue.
+     * @return Dropped event count.
+     **/
+    uint64_t get_dropped( ) const;
+
+};
@@ -0,0 +1,119 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_machine_arena::chip8_machine_arena( const uint32_t arena_capacity )
+    : states{ nullptr },
+    generations( arena_capacity, 0 ),
+    free_list( arena_capacity ),
+    capacity{ arena_capacity }
+{
+    const auto alignment = std::align_val_t{ alignof( chip8_machine_state ) };
+
+    if ( capacity > 0 )
+        states = (chip8_machine_state*)::operator new( sizeof( chip8_machine_state ) * capacity, alignment );
+
+    for ( auto slot_id = uint32_t( 0 ); slot_id < capacity; slot_id++ )
+        free_list[ slot_id ] = capacity - slot_id - 1;
+}
+
+chip8_machine_arena::chip8_machine_arena( chip8_machine_arena&& other ) noexcept
+    : states{ other.states },
+    generations{ std::move( other.generations ) },
+    free_list{ std::move( other.free_list ) },
+    capacity{ other.capacity }
+{
+    other.states   = nullptr;
+    other.capacity = 0;
+}
+
+chip8_machine_arena::~chip8_machine_arena( ) {
+    if ( states )
+        ::operator delete( states, std::align_val_t{ alignof( chip8_machine_state ) } );
+}
+
+chip8_machine_handle chip8_machine_arena::allocate( ) {
+    const auto handle = acquire( );
+
+    if ( handle.index != Invalid )
+        std::memset( &states[ handle.index ], 0, sizeof( chip8_machine_state ) );
+
+    return handle;
+}
+
+chip8_machine_handle chip8_machine_arena::clone( const chip8_machine_state& source ) {
+    const auto handle = acquire( );
+
+    if ( handle.index != Invalid )
+        std::memcpy( &states[ handle.index ], &source, sizeof( chip8_machine_state ) );
+
+    return handle;
+}
+
+chip8_machine_handle chip8_machine_arena::clone( const chip8_machine_handle source ) {
+    if ( !valid( source ) )
+        return { Invalid, 0 };
+
+    return clone( states[ source.index ] );
+}
+
+void chip8_machine_arena::release( const chip8_machine_handle handle ) {
+    if ( !valid( handle ) )
+        return;
+
+    generations[ handle.index ] += 1;
+
+    free_list.push_back( handle.index );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_machine_handle chip8_machine_arena::acquire( ) {
+    if ( free_list.empty( ) )
+        return { Invalid, 0 };
+
+    const auto slot_id = free_list.back( );
+
+    free_list.pop_back( );
+
+    generations[ slot_id ] += 1;
+
+    return { slot_id, generations[ slot_id ] };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_machine_arena::valid( const chip8_machine_handle handle ) const {
+    if ( handle.index >= capacity )
+        return false;
+
+    const auto generation = generations[ handle.index ];
+
+    return generation == handle.generation && ( generation & 0x01 );
+}
+
+chip8_machine_state& chip8_machine_arena::get( const chip8_machine_handle handle ) {
+    return states[ handle.index ];
+}
+
+const chip8_machine_state& chip8_machine_arena::get( const chip8_machine_handle handle ) const {
+    return states[ handle.index ];
+}
+
+uint32_t chip8_machine_arena::get_count( ) const {
+    return capacity - uint32_t( free_list.size( ) );
+}
+
+uint32_t chip8_machine_arena::get_capacity( ) const {
+    return capacity;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_machine_state& chip8_machine_arena::operator[]( const chip8_machine_handle handle ) {
+    return get( handle );
+}
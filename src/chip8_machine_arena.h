@@ -0,0 +1,179 @@
+#pragma once
+
+#include "chip8_rom_library.h"
+
+/**
+ * Define a complete machine state, trivially copyable so cloning
+ * or saving a machine is a single copy.
+ * @field hot : Registers, PC, I, SP, keys, timers and options.
+ * @field random : Random generator state.
+ * @field rom_size : Loaded ROM size.
+ * @field rom_instruction_per_second : Loaded ROM speed, 0 for default.
+ * @field rom_hash : Loaded ROM content hash, a state never point to
+ *                   memory owned by a ROM library or bundle.
+ * @field stack : Call stack addresses.
+ * @field screen : Screen buffer bits.
+ * @field memory : Whole memory, font and ROM included.
+ **/
+struct alignas( 64 ) chip8_machine_state {
+    chip8_hot_state hot;
+    chip8_random_state random;
+    uint16_t rom_size;
+    uint32_t rom_instruction_per_second;
+    uint64_t rom_hash;
+    std::array<uint16_t, chip8_stack_mananger::Capacity> stack;
+    std::array<uint8_t, chip8_screen_manager_unit::dimenion / 8> screen;
+    std::array<uint8_t, chip8_memory_manager_unit::Capacity> memory;
+};
+
+static_assert( std::is_trivially_copyable_v<chip8_machine_state> );
+
+/**
+ * Define handle to an arena machine state.
+ * @field index : Machine state index inside the arena.
+ * @field generation : Machine slot generation, detect stale handle.
+ **/
+struct chip8_machine_handle {
+    uint32_t index;
+    uint32_t generation;
+};
+
+/**
+ * chip8_machine_arena class
+ * @note Store a fixed count of machine states in one contiguous,
+ *       cache line aligned block. Allocating, cloning or releasing
+ *       a machine never touch the heap.
+ *       Only parked states are pooled, running one still need a
+ *       chip8 instance, with its heap allocated opcode table,
+ *       callbacks and buffers, and copy the state in and out with
+ *       load_state and save_state.
+ **/
+class chip8_machine_arena final {
+
+public:
+    static constexpr uint32_t Invalid = 0xFFFFFFFF;
+
+private:
+    chip8_machine_state* states;
+    std::vector<uint32_t> generations;
+    std::vector<uint32_t> free_list;
+    uint32_t capacity;
+
+public:
+    /**
+     * Constructor
+     * @param arena_capacity : Maximum count of machine states.
+     **/
+    chip8_machine_arena( const uint32_t arena_capacity );
+
+    /**
+     * Move-Constructor
+     * @param other : Target arena to take ownership of.
+     **/
+    chip8_machine_arena( chip8_machine_arena&& other ) noexcept;
+
+    /**
+     * Copy-Constructor
+     * @note Arena can't be copied, clone machine instead.
+     **/
+    chip8_machine_arena( const chip8_machine_arena& ) = delete;
+
+    /**
+     * Destructor
+     **/
+    ~chip8_machine_arena( );
+
+    /**
+     * allocate function
+     * @note Allocate a zeroed machine state.
+     * @return Machine handle, index is Invalid when arena is full.
+     **/
+    chip8_machine_handle allocate( );
+
+    /**
+     * clone function
+     * @note Allocate a machine state copied from a template.
+     * @param source : Template machine state.
+     * @return Machine handle, index is Invalid when arena is full.
+     **/
+    chip8_machine_handle clone( const chip8_machine_state& source );
+
+    /**
+     * clone function
+     * @note Allocate a machine state copied from an arena machine.
+     * @param source : Template machine handle.
+     * @return Machine handle, index is Invalid when arena is full
+     *         or source is invalid.
+     **/
+    chip8_machine_handle clone( const chip8_machine_handle source );
+
+    /**
+     * release method
+     * @note Give back a machine to the arena, handle become stale.
+     * @param handle : Target machine handle.
+     **/
+    void release( const chip8_machine_handle handle );
+
+private:
+    /**
+     * acquire function
+     * @note Take a free slot and bump its generation.
+     * @return Machine handle, index is Invalid when arena is full.
+     **/
+    chip8_machine_handle acquire( );
+
+public:
+    /**
+     * valid function
+     * @note Get if a handle refer to a live machine.
+     * @param handle : Target machine handle.
+     * @return True when handle is live.
+     **/
+    bool valid( const chip8_machine_handle handle ) const;
+
+    /**
+     * get function
+     * @note Get machine state, handle must be valid.
+     * @param handle : Target machine handle.
+     * @return Reference to machine state.
+     **/
+    chip8_machine_state& get( const chip8_machine_handle handle );
+
+    /**
+     * get function
+     * @note Get machine state, handle must be valid.
+     * @param handle : Target machine handle.
+     * @return Reference to immutable machine state.
+     **/
+    const chip8_machine_state& get( const chip8_machine_handle handle ) const;
+
+    /**
+     * get_count function
+     * @note Get count of live machines.
+     * @return Live machine count.
+     **/
+    uint32_t get_count( ) const;
+
+    /**
+     * get_capacity function
+     * @note Get maximum count of machines.
+     * @return Arena capacity.
+     **/
+    uint32_t get_capacity( ) const;
+
+public:
+    /**
+     * operator=
+     * @note Arena can't be copied, clone machine instead.
+     **/
+    chip8_machine_arena& operator=( const chip8_machine_arena& ) = delete;
+
+    /**
+     * operator[]
+     * @note Get machine state, handle must be valid.
+     * @param handle : Target machine handle.
+     * @return Reference to machine state.
+     **/
+    chip8_machine_state& operator[]( const chip8_machine_handle handle );
+
+};
@@ -0,0 +1,136 @@
+#include "chip8.h"
+
+#ifdef WINDOWS
+#   define NOMINMAX
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_mapped_file::chip8_mapped_file( )
+    : data{ nullptr },
+    size{ 0 },
+    handle{ nullptr }
+{ }
+
+chip8_mapped_file::chip8_mapped_file( chip8_mapped_file&& other ) noexcept
+    : data{ other.data },
+    size{ other.size },
+    handle{ other.handle }
+{
+    other.data   = nullptr;
+    other.size   = 0;
+    other.handle = nullptr;
+}
+
+chip8_mapped_file::~chip8_mapped_file( ) {
+    close( );
+}
+
+bool chip8_mapped_file::open( chip8_string file_path ) {
+    close( );
+
+#ifdef WINDOWS
+    auto file = CreateFileA( file_path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+
+    if ( file == INVALID_HANDLE_VALUE )
+        return false;
+
+    auto file_size = LARGE_INTEGER{ };
+
+    if ( GetFileSizeEx( file, &file_size ) && file_size.QuadPart > 0 ) {
+        auto mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+
+        if ( mapping ) {
+            data   = (const uint8_t*)MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+            size   = size_t( file_size.QuadPart );
+            handle = mapping;
+
+            if ( !data )
+                close( );
+        }
+    }
+
+    CloseHandle( file );
+#else
+    const auto file = ::open( file_path, O_RDONLY );
+
+    if ( file < 0 )
+        return false;
+
+    struct stat file_stat;
+
+    if ( fstat( file, &file_stat ) == 0 && S_ISREG( file_stat.st_mode ) && file_stat.st_size > 0 ) {
+        auto* mapping = mmap( nullptr, size_t( file_stat.st_size ), PROT_READ, MAP_PRIVATE, file, 0 );
+
+        if ( mapping != MAP_FAILED ) {
+            data   = (const uint8_t*)mapping;
+            size   = size_t( file_stat.st_size );
+            handle = mapping;
+        }
+    }
+
+    ::close( file );
+#endif
+
+    return exist( );
+}
+
+void chip8_mapped_file::close( ) {
+    if ( !handle )
+        return;
+
+#ifdef WINDOWS
+    if ( data )
+        UnmapViewOfFile( data );
+
+    CloseHandle( (HANDLE)handle );
+#else
+    munmap( handle, size );
+#endif
+
+    data   = nullptr;
+    size   = 0;
+    handle = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_mapped_file::exist( ) const {
+    return data != nullptr;
+}
+
+const uint8_t* chip8_mapped_file::get_data( ) const {
+    return data;
+}
+
+size_t chip8_mapped_file::get_size( ) const {
+    return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	OPERATOR ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_mapped_file& chip8_mapped_file::operator=( chip8_mapped_file&& other ) noexcept {
+    if ( this != &other ) {
+        close( );
+
+        data   = other.data;
+        size   = other.size;
+        handle = other.handle;
+
+        other.data   = nullptr;
+        other.size   = 0;
+        other.handle = nullptr;
+    }
+
+    return chip8_self;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "chip8_cpu_implementation.h"
+
+/**
+ * chip8_mapped_file class
+ * @note Read only memory mapping of a file, the mapping live
+ *       as long as the instance.
+ **/
+class chip8_mapped_file final {
+
+private:
+    const uint8_t* data;
+    size_t size;
+    void* handle;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_mapped_file( );
+
+    /**
+     * Move-Constructor
+     * @param other : Target mapping to take ownership of.
+     **/
+    chip8_mapped_file( chip8_mapped_file&& other ) noexcept;
+
+    /**
+     * Copy-Constructor
+     * @note Mapping can't be shared between instances.
+     **/
+    chip8_mapped_file( const chip8_mapped_file& ) = delete;
+
+    /**
+     * Destructor
+     **/
+    ~chip8_mapped_file( );
+
+    /**
+     * open function
+     * @note Map target file in memory as read only.
+     * @param file_path : Target file path.
+     * @return True when the mapping succeded.
+     **/
+    bool open( chip8_string file_path );
+
+    /**
+     * close method
+     * @note Unmap current file if any.
+     **/
+    void close( );
+
+public:
+    /**
+     * exist function
+     * @note Get if a file is currently mapped.
+     * @return True when a file is mapped.
+     **/
+    bool exist( ) const;
+
+    /**
+     * get_data function
+     * @note Get mapped file content.
+     * @return Pointer to immutable file content or nullptr.
+     **/
+    const uint8_t* get_data( ) const;
+
+    /**
+     * get_size function
+     * @note Get mapped file size.
+     * @return Mapped file size in bytes.
+     **/
+    size_t get_size( ) const;
+
+public:
+    /**
+     * operator=
+     * @note Move assignement operator.
+     * @param other : Target mapping to take ownership of.
+     * @return Reference to current mapping.
+     **/
+    chip8_mapped_file& operator=( chip8_mapped_file&& other ) noexcept;
+
+    /**
+     * operator=
+     * @note Mapping can't be shared between instances.
+     **/
+    chip8_mapped_file& operator=( const chip8_mapped_file& ) = delete;
+
+};
@@ -0,0 +1,96 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_metrics::chip8_metrics( const chip8_cpu_timer_manager& cpu_timers )
+    : instructions{ 0 },
+    frames{ 0 },
+    draws{ 0 },
+    sleep_time{ 0 },
+    overruns{ 0 },
+    key_waits{ 0 },
+    exits{ },
+    timers{ cpu_timers },
+    last_cycles{ 0 },
+    is_exported{ false }
+{ }
+
+chip8_metrics::~chip8_metrics( ) {
+    if ( is_exported.load( ) )
+        chip8_metrics_exporter::get( ).detach( chip8_self );
+}
+
+void chip8_metrics::publish(
+    const uint64_t cycles,
+    const uint64_t draw_count,
+    const chip8_pacer_stats& pacing,
+    const uint64_t frame_count
+) {
+    // Instruction count restart on reset, only publish the delta.
+    const auto delta = cycles >= last_cycles ? cycles - last_cycles : cycles;
+
+    last_cycles = cycles;
+
+    add( instructions, delta );
+
+    add( frames, frame_count );
+
+    draws.store( draw_count, std::memory_order_relaxed );
+    sleep_time.store( uint64_t( pacing.sleep_time ), std::memory_order_relaxed );
+    overruns.store( pacing.overruns, std::memory_order_relaxed );
+}
+
+void chip8_metrics::add_key_wait( ) {
+    add( key_waits, 1 );
+}
+
+void chip8_metrics::add_exit( const echip8_states state ) {
+    if ( state < StateCount )
+        add( exits[ state ], 1 );
+}
+
+void chip8_metrics::set_exported( const bool value ) const {
+    is_exported.store( value );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_metrics::add( std::atomic<uint64_t>& counter, const uint64_t value ) {
+    counter.store( counter.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_metrics_snapshot chip8_metrics::get_snapshot( ) const {
+    auto snapshot = chip8_metrics_snapshot{ };
+
+    snapshot.instructions = instructions.load( std::memory_order_relaxed );
+    snapshot.frames       = frames.load( std::memory_order_relaxed );
+    snapshot.draws        = draws.load( std::memory_order_relaxed );
+    snapshot.sleep_time   = sleep_time.load( std::memory_order_relaxed );
+    snapshot.overruns     = overruns.load( std::memory_order_relaxed );
+    snapshot.timer_ticks  = timers.get_ticks( );
+    snapshot.key_waits    = key_waits.load( std::memory_order_relaxed );
+
+    for ( auto state = uint32_t( 0 ); state < StateCount; state++ )
+        snapshot.exits[ state ] = exits[ state ].load( std::memory_order_relaxed );
+
+    return snapshot;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_string chip8_metrics::get_state_name( const echip8_states state ) {
+    static constexpr chip8_string Names[ StateCount ] = {
+        "run", "eop", "nip", "iir", "uop", "sgf", "iik", "epv", "hlt", "wfk", "ilr", "brk"
+    };
+
+    if ( state < StateCount )
+        return Names[ state ];
+
+    return "undefined";
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "chip8_profiler.h"
+
+/**
+ * Define a machine metrics snapshot, every counter is monotonic.
+ * @field instructions : Executed instruction count.
+ * @field frames : Emulated 60Hz frame count.
+ * @field draws : Display count.
+ * @field sleep_time : Pacer sleep time in nanoseconds.
+ * @field overruns : Pacer frame overrun count.
+ * @field timer_ticks : Delay and sound timers update count.
+ * @field key_waits : FX0A wait count.
+ * @field exits : Execution end count per echip8_states.
+ **/
+struct chip8_metrics_snapshot {
+    uint64_t instructions;
+    uint64_t frames;
+    uint64_t draws;
+    uint64_t sleep_time;
+    uint64_t overruns;
+    uint64_t timer_ticks;
+    uint64_t key_waits;
+    std::array<uint64_t, ecs_brk + 1> exits;
+};
+
+/**
+ * chip8_metrics class
+ * @note Machine counters readable from any thread. The emulation
+ *       thread is the only writer so counters are updated with
+ *       relaxed load and store, never a locked instruction, and are
+ *       published once per emulated frame. A snapshot reads each
+ *       counter atomically, not all counters at a single instant.
+ **/
+class chip8_metrics final {
+
+public:
+    static constexpr uint32_t StateCount = ecs_brk + 1;
+
+private:
+    alignas( 64 ) std::atomic<uint64_t> instructions;
+    std::atomic<uint64_t> frames;
+    std::atomic<uint64_t> draws;
+    std::atomic<uint64_t> sleep_time;
+    std::atomic<uint64_t> overruns;
+    std::atomic<uint64_t> key_waits;
+    std::array<std::atomic<uint64_t>, StateCount> exits;
+    const chip8_cpu_timer_manager& timers;
+    uint64_t last_cycles;
+    mutable std::atomic<bool> is_exported;
+
+public:
+    /**
+     * Constructor
+     * @param cpu_timers : Reference to machine timers, counting
+     *                    their own updates.
+     **/
+    chip8_metrics( const chip8_cpu_timer_manager& cpu_timers );
+
+    /**
+     * Destructor
+     * @note Detach from the metrics exporter, it never keep a
+     *       pointer to destroyed metrics.
+     **/
+    ~chip8_metrics( );
+
+    /**
+     * publish method
+     * @note Publish machine counters, emulation thread only.
+     * @param cycles : Executed instruction count since last reset.
+     * @param draw_count : Display count.
+     * @param pacing : Current pacer statistics.
+     * @param frame_count : Emulated frames ended since last publish.
+     **/
+    void publish(
+        const uint64_t cycles,
+        const uint64_t draw_count,
+        const chip8_pacer_stats& pacing,
+        const uint64_t frame_count
+    );
+
+    /**
+     * add_key_wait method
+     * @note Count a FX0A wait, emulation thread only.
+     **/
+    void add_key_wait( );
+
+    /**
+     * add_exit method
+     * @note Count an execution end, emulation thread only.
+     * @param state : Final execution state.
+     **/
+    void add_exit( const echip8_states state );
+
+    /**
+     * set_exported method
+     * @note Mark metrics as attached to the metrics exporter.
+     * @param value : True while attached.
+     **/
+    void set_exported( const bool value ) const;
+
+private:
+    /**
+     * add method
+     * @note Single writer counter increment.
+     * @param counter : Target counter.
+     * @param value : Value to add.
+     **/
+    static void add( std::atomic<uint64_t>& counter, const uint64_t value );
+
+public:
+    /**
+     * get_snapshot function
+     * @note Read every counter, lock-free and callable from any
+     *       thread.
+     * @return Metrics snapshot.
+     **/
+    chip8_metrics_snapshot get_snapshot( ) const;
+
+public:
+    /**
+     * get_state_name function
+     * @note Get short name of an execution state.
+     * @param state : Target execution state.
+     * @return Execution state name like "eop".
+     **/
+    static chip8_string get_state_name( const echip8_states state );
+
+};
@@ -0,0 +1,262 @@
+#include "chip8.h"
+
+#ifndef WINDOWS
+#   include <poll.h>
+#   include <sys/socket.h>
+#   include <sys/un.h>
+#   include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_metrics_exporter::chip8_metrics_exporter( )
+    : sources_mutex{ },
+    sources{ },
+    next_id{ 0 },
+    is_serving{ false },
+    server_thread{ },
+    socket_path{ }
+{ }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_metrics_exporter::~chip8_metrics_exporter( ) {
+    stop( );
+
+    auto lock = std::lock_guard<std::mutex>{ sources_mutex };
+
+    // Machines outliving the exporter must not detach from it.
+    for ( const auto& source : sources )
+        source.metrics->set_exported( false );
+
+    sources.clear( );
+}
+
+uint32_t chip8_metrics_exporter::attach( chip8_string name, const chip8_metrics& metrics ) {
+    auto lock = std::lock_guard<std::mutex>{ sources_mutex };
+
+    sources.push_back( { next_id, name, &metrics } );
+
+    metrics.set_exported( true );
+
+    return next_id++;
+}
+
+void chip8_metrics_exporter::detach( const uint32_t id ) {
+    auto lock = std::lock_guard<std::mutex>{ sources_mutex };
+
+    auto by_id = [ id ]( const chip8_metrics_source& source ) -> bool {
+        return source.id == id;
+    };
+
+    sources.erase( std::remove_if( sources.begin( ), sources.end( ), by_id ), sources.end( ) );
+}
+
+void chip8_metrics_exporter::detach( const chip8_metrics& metrics ) {
+    auto lock = std::lock_guard<std::mutex>{ sources_mutex };
+
+    auto by_metrics = [ &metrics ]( const chip8_metrics_source& source ) -> bool {
+        return source.metrics == &metrics;
+    };
+
+    sources.erase( std::remove_if( sources.begin( ), sources.end( ), by_metrics ), sources.end( ) );
+
+    metrics.set_exported( false );
+}
+
+bool chip8_metrics_exporter::write( chip8_string metrics_path ) {
+    const auto text      = get_text( );
+    const auto temp_path = std::string( metrics_path ) + ".tmp";
+
+    auto* metrics_file = fopen( temp_path.c_str( ), "w" );
+
+    if ( !metrics_file )
+        return false;
+
+    const auto is_written = fwrite( text.data( ), 1, text.size( ), metrics_file ) == text.size( );
+
+    if ( fclose( metrics_file ) != 0 || !is_written )
+        return false;
+
+    // Scrapers never see a partial file.
+    auto error = std::error_code{ };
+
+    std::filesystem::rename( temp_path, metrics_path, error );
+
+    return !error;
+}
+
+bool chip8_metrics_exporter::serve( chip8_string path ) {
+    stop( );
+
+#ifdef WINDOWS
+    return false;
+#else
+    auto address = sockaddr_un{ };
+
+    if ( std::strlen( path ) >= sizeof( address.sun_path ) )
+        return false;
+
+    const auto server = socket( AF_UNIX, SOCK_STREAM, 0 );
+
+    if ( server < 0 )
+        return false;
+
+    address.sun_family = AF_UNIX;
+
+    std::strncpy( address.sun_path, path, sizeof( address.sun_path ) - 1 );
+
+    unlink( path );
+
+    if ( bind( server, (const sockaddr*)&address, sizeof( address ) ) != 0 || listen( server, 8 ) != 0 ) {
+        close( server );
+
+        return false;
+    }
+
+    socket_path   = path;
+    is_serving    = true;
+    server_thread = std::thread( [ this, server ]( ) -> void { serve_loop( server ); } );
+
+    return true;
+#endif
+}
+
+void chip8_metrics_exporter::stop( ) {
+    is_serving = false;
+
+    if ( server_thread.joinable( ) )
+        server_thread.join( );
+
+#ifndef WINDOWS
+    if ( !socket_path.empty( ) )
+        unlink( socket_path.c_str( ) );
+#endif
+
+    socket_path.clear( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_metrics_exporter::serve_loop( const int server ) {
+#ifndef WINDOWS
+    while ( is_serving ) {
+        // Poll with timeout so stop is noticed without a connection.
+        auto server_poll = pollfd{ server, POLLIN, 0 };
+
+        if ( poll( &server_poll, 1, 100 ) <= 0 )
+            continue;
+
+        const auto client = accept( server, nullptr, nullptr );
+
+        if ( client < 0 )
+            continue;
+
+        const auto text = get_text( );
+        auto offset     = size_t( 0 );
+
+        while ( offset < text.size( ) ) {
+            const auto sent = send( client, text.data( ) + offset, text.size( ) - offset, MSG_NOSIGNAL );
+
+            if ( sent <= 0 )
+                break;
+
+            offset += size_t( sent );
+        }
+
+        close( client );
+    }
+
+    close( server );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_metrics_exporter::append_sample(
+    std::string& text,
+    chip8_string name,
+    const std::string& machine,
+    chip8_string state,
+    chip8_string value
+) {
+    text.append( name );
+    text.append( "{machine=\"" );
+
+    // Label values escape backslash, quote and line feed.
+    for ( const auto character : machine ) {
+        switch ( character ) {
+            case '\\' : text.append( "\\\\" ); break;
+            case '"'  : text.append( "\\\"" ); break;
+            case '\n' : text.append( "\\n" ); break;
+
+            default : text.push_back( character ); break;
+        }
+    }
+
+    if ( state ) {
+        text.append( "\",state=\"" );
+        text.append( state );
+    }
+
+    text.append( "\"} " );
+    text.append( value );
+    text.push_back( '\n' );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+std::string chip8_metrics_exporter::get_text( ) {
+    auto lock      = std::lock_guard<std::mutex>{ sources_mutex };
+    auto text      = std::string{ };
+    auto snapshots = std::vector<chip8_metrics_snapshot>{ };
+    auto value     = std::array<char, 32>{ };
+
+    for ( const auto& source : sources )
+        snapshots.emplace_back( source.metrics->get_snapshot( ) );
+
+    auto write_family = [ & ]( chip8_string name, chip8_string help, uint64_t chip8_metrics_snapshot::* counter, const double scale ) -> void {
+        text.append( "# HELP " ).append( name ).append( " " ).append( help ).append( "\n" );
+        text.append( "# TYPE " ).append( name ).append( " counter\n" );
+
+        for ( auto source_id = size_t( 0 ); source_id < sources.size( ); source_id++ ) {
+            snprintf( value.data( ), value.size( ), "%.15g", double( snapshots[ source_id ].*counter ) * scale );
+
+            append_sample( text, name, sources[ source_id ].name, nullptr, value.data( ) );
+        }
+    };
+
+    write_family( "chip8_instructions_total", "Executed instructions.", &chip8_metrics_snapshot::instructions, 1.0 );
+    write_family( "chip8_frames_total", "Emulated 60Hz frames.", &chip8_metrics_snapshot::frames, 1.0 );
+    write_family( "chip8_draws_total", "Display instructions.", &chip8_metrics_snapshot::draws, 1.0 );
+    write_family( "chip8_timer_ticks_total", "Delay and sound timers updates.", &chip8_metrics_snapshot::timer_ticks, 1.0 );
+    write_family( "chip8_key_waits_total", "FX0A waits for a key.", &chip8_metrics_snapshot::key_waits, 1.0 );
+    write_family( "chip8_overruns_total", "Frames that missed their deadline.", &chip8_metrics_snapshot::overruns, 1.0 );
+    write_family( "chip8_sleep_seconds_total", "Time slept by the pacer.", &chip8_metrics_snapshot::sleep_time, 1e-9 );
+
+    text.append( "# HELP chip8_exits_total Execution ends by state.\n# TYPE chip8_exits_total counter\n" );
+
+    for ( auto source_id = size_t( 0 ); source_id < sources.size( ); source_id++ ) {
+        for ( auto state = uint32_t( 0 ); state < chip8_metrics::StateCount; state++ ) {
+            snprintf( value.data( ), value.size( ), "%" PRIu64, snapshots[ source_id ].exits[ state ] );
+
+            append_sample( text, "chip8_exits_total", sources[ source_id ].name, chip8_metrics::get_state_name( echip8_states( state ) ), value.data( ) );
+        }
+    }
+
+    return text;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_metrics_exporter& chip8_metrics_exporter::get( ) {
+    static auto exporter = chip8_metrics_exporter{ };
+
+    return exporter;
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "chip8_metrics.h"
+
+/**
+ * Define an exported machine.
+ * @field id : Exporter attach index.
+ * @field name : Machine name, Prometheus machine label.
+ * @field metrics : Pointer to machine metrics.
+ **/
+struct chip8_metrics_source {
+    uint32_t id;
+    std::string name;
+    const chip8_metrics* metrics;
+};
+
+/**
+ * chip8_metrics_exporter class
+ * @note Process wide Prometheus text exporter of attached machine
+ *       metrics, to a file or to a local Unix socket served by a
+ *       background thread.
+ **/
+class chip8_metrics_exporter final {
+
+public:
+    static constexpr uint32_t Invalid = 0xFFFFFFFF;
+
+private:
+    std::mutex sources_mutex;
+    std::vector<chip8_metrics_source> sources;
+    uint32_t next_id;
+    std::atomic<bool> is_serving;
+    std::thread server_thread;
+    std::string socket_path;
+
+private:
+    /**
+     * Constructor
+     * @note Exporter is only reachable through get.
+     **/
+    chip8_metrics_exporter( );
+
+public:
+    /**
+     * Copy-Constructor
+     * @note Exporter is unique to the process.
+     **/
+    chip8_metrics_exporter( const chip8_metrics_exporter& ) = delete;
+
+    /**
+     * Destructor
+     **/
+    ~chip8_metrics_exporter( );
+
+    /**
+     * attach function
+     * @note Export a machine metrics, machines detach themselves
+     *       when destroyed.
+     * @param name : Machine name.
+     * @param metrics : Target machine metrics.
+     * @return Source id for detach.
+     **/
+    uint32_t attach( chip8_string name, const chip8_metrics& metrics );
+
+    /**
+     * detach method
+     * @note Stop exporting a machine metrics.
+     * @param id : Source id returned by attach.
+     **/
+    void detach( const uint32_t id );
+
+    /**
+     * detach method
+     * @note Stop exporting every source of a machine metrics.
+     * @param metrics : Target machine metrics.
+     **/
+    void detach( const chip8_metrics& metrics );
+
+    /**
+     * write function
+     * @note Write Prometheus text to a file, replaced atomically.
+     * @param metrics_path : Target file path.
+     * @return True when the file was written.
+     **/
+    bool write( chip8_string metrics_path );
+
+    /**
+     * serve function
+     * @note Serve Prometheus text to each connection on a local
+     *       Unix socket, POSIX only.
+     * @param path : Target socket path, replaced when it exists.
+     * @return True when the socket is listening.
+     **/
+    bool serve( chip8_string path );
+
+    /**
+     * stop method
+     * @note Stop serving and remove the socket.
+     **/
+    void stop( );
+
+private:
+    /**
+     * serve_loop method
+     * @note Server thread body.
+     * @param server : Listening socket.
+     **/
+    void serve_loop( const int server );
+
+    /**
+     * append_sample method
+     * @note Append a sample line, machine label value is escaped
+     *       per the Prometheus text format.
+     * @param text : Target Prometheus text.
+     * @param name : Metric name.
+     * @param machine : Machine name.
+     * @param state : State label value, nullptr when unused.
+     * @param value : Formatted sample value.
+     **/
+    static void append_sample(
+        std::string& text,
+        chip8_string name,
+        const std::string& machine,
+        chip8_string state,
+        chip8_string value
+    );
+
+public:
+    /**
+     * get_text function
+     * @note Get Prometheus text of every attached machine.
+     * @return Prometheus text exposition.
+     **/
+    std::string get_text( );
+
+public:
+    /**
+     * get function
+     * @note Get process exporter.
+     * @return Reference to process exporter.
+     **/
+    static chip8_metrics_exporter& get( );
+
+public:
+    /**
+     * operator=
+     * @note Exporter is unique to the process.
+     **/
+    chip8_metrics_exporter& operator=( const chip8_metrics_exporter& ) = delete;
+
+};
@@ -3,10 +3,11 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
-chip8_memory_manager_unit::chip8_memory_manager_unit( )
-    : memory{ },
-    registers{ },
-    stack{ }
+chip8_memory_manager_unit::chip8_memory_manager_unit( chip8_hot_state& hot_state )
+    : state{ hot_state },
+    stack{ hot_state },
+    memory{ },
+    generations{ }
 {
     reset( );
 }
@@ -34,6 +35,8 @@ void chip8_memory_manager_unit::reset( ) {
     auto* font_memory = get_font_memory( );
 
     std::memmove( font_memory, font, sizeof( font ) );
+
+    mark_dirty( eca_font_start, sizeof( font ) );
 }
 
 void chip8_memory_manager_unit::write(
@@ -41,6 +44,18 @@ void chip8_memory_manager_unit::write(
     const uint8_t value 
 ) {
     memory[ address ] = value;
+
+    generations[ ( address & ( Capacity - 1 ) ) / PageSize ] += 1;
+}
+
+void chip8_memory_manager_unit::mark_dirty( const uint16_t address, const uint16_t length ) {
+    if ( length == 0 )
+        return;
+
+    const auto last = std::min( uint32_t( address ) + length - 1, uint32_t( Capacity - 1 ) );
+
+    for ( auto page_id = uint32_t( address / PageSize ); page_id <= last / PageSize; page_id++ )
+        generations[ page_id ] += 1;
 }
 
 bool chip8_memory_manager_unit::push(
@@ -57,9 +72,31 @@ void chip8_memory_manager_unit::set_key(
     const auto key_id = uint8_t( key );
 
     if ( key_pressed )
-        keys |= ( 1 << key_id );
+        state.keys |= ( 1 << key_id );
     else
-        keys &= ~( 1 << key_id );
+        state.keys &= ~( 1 << key_id );
+}
+
+void chip8_memory_manager_unit::save_state( chip8_machine_state& machine_state ) const {
+    machine_state.memory = memory;
+
+    stack.save_state( machine_state );
+}
+
+void chip8_memory_manager_unit::load_state( const chip8_machine_state& machine_state ) {
+    // Unchanged pages keep their generation, so caches survive a rewind.
+    for ( auto page_id = uint16_t( 0 ); page_id < PageCount; page_id++ ) {
+        const auto offset = page_id * PageSize;
+
+        if ( std::memcmp( memory.data( ) + offset, machine_state.memory.data( ) + offset, PageSize ) == 0 )
+            continue;
+
+        std::memcpy( memory.data( ) + offset, machine_state.memory.data( ) + offset, PageSize );
+
+        generations[ page_id ] += 1;
+    }
+
+    stack.load_state( machine_state );
 }
 
 void chip8_memory_manager_unit::dump( ) const {
@@ -96,7 +133,7 @@ void chip8_memory_manager_unit::dump_registers( ) const {
     
     auto idx = 0;
 
-    for ( const auto regiser : registers )
+    for ( const auto regiser : state.V )
         printf( "v[ %X ] %2X\n", idx++, regiser );
 }
 
@@ -152,8 +189,20 @@ uint8_t* chip8_memory_manager_unit::get_rom_memory( ) const{
     return (uint8_t*)&memory[ eca_rom_start ];
 }
 
+const uint8_t* chip8_memory_manager_unit::get_memory( ) const {
+    return memory.data( );
+}
+
+const chip8_stack_mananger& chip8_memory_manager_unit::get_stack( ) const {
+    return stack;
+}
+
+uint32_t chip8_memory_manager_unit::get_generation( const uint16_t page_id ) const {
+    return generations[ page_id % PageCount ];
+}
+
 uint8_t& chip8_memory_manager_unit::v( const uint8_t register_id ) {
-    return registers[ register_id ];
+    return state.V[ register_id ];
 }
 
 uint8_t chip8_memory_manager_unit::read( const uint16_t address ) const {
@@ -165,7 +214,7 @@ std::tuple<uint16_t, bool> chip8_memory_manager_unit::pop( ) {
 }
 
 bool chip8_memory_manager_unit::key( const uint8_t key_id ) const {
-    const auto key_state = keys >> ( 15 - key_id );
+    const auto key_state = state.keys >> key_id;
 
     return key_state & 0x01;
 }
@@ -5,23 +5,30 @@
 /** 
  * chip8_memory_manager_unit class
  * @note Store and manage memory, call stack, registers and ROM.
+ *       Registers and keys live in the machine hot state. Each
+ *       PageSize page has a generation bumped on every write, so
+ *       tools detect self-modification and cache per page.
  **/
 class chip8_memory_manager_unit final {
 
+public:
     static constexpr uint16_t Capacity      = 4096;
     static constexpr uint16_t RegisterCount = 16;
+    static constexpr uint16_t PageSize      = 256;
+    static constexpr uint16_t PageCount     = Capacity / PageSize;
 
 private:
-    std::array<uint8_t, Capacity> memory;
-    std::array<uint8_t, RegisterCount> registers;
+    chip8_hot_state& state;
     chip8_stack_mananger stack;
-    uint16_t keys;
+    std::array<uint8_t, Capacity> memory;
+    std::array<uint32_t, PageCount> generations;
 
 public:
     /**
      * Constucor
+     * @param hot_state : Reference to machine hot state.
      **/
-    chip8_memory_manager_unit( );
+    chip8_memory_manager_unit( chip8_hot_state& hot_state );
 
     /**
      * reset method
@@ -37,6 +44,14 @@ public:
      **/
     void write( const uint16_t address, const uint8_t value );
 
+    /**
+     * mark_dirty method
+     * @note Bump generation of pages written without write.
+     * @param address : First written address.
+     * @param length : Written byte count.
+     **/
+    void mark_dirty( const uint16_t address, const uint16_t length );
+
     /**
      * push function
      * @note Push address on top of the call stack.
@@ -61,6 +76,21 @@ public:
         const bool key_pressed
     );
 
+    /**
+     * save_state method
+     * @note Copy memory and call stack to a machine state.
+     * @param machine_state : Target machine state.
+     **/
+    void save_state( chip8_machine_state& machine_state ) const;
+
+    /**
+     * load_state method
+     * @note Copy memory and call stack from a machine state, only
+     *       pages that differ are copied and marked dirty.
+     * @param machine_state : Source machine state.
+     **/
+    void load_state( const chip8_machine_state& machine_state );
+
     /**
      * dump method
      * @note Dump entire memory content.
@@ -119,6 +149,28 @@ public:
      **/
     uint8_t* get_rom_memory( ) const;
 
+    /**
+     * get_memory function
+     * @note Get whole memory, font and ROM included.
+     * @return Pointer to imutable memory.
+     **/
+    const uint8_t* get_memory( ) const;
+
+    /**
+     * get_stack function
+     * @note Get call stack.
+     * @return Reference to imutable call stack.
+     **/
+    const chip8_stack_mananger& get_stack( ) const;
+
+    /**
+     * get_generation function
+     * @note Get a page generation, bumped on every write to it.
+     * @param page_id : Target page, address / PageSize.
+     * @return Page generation.
+     **/
+    uint32_t get_generation( const uint16_t page_id ) const;
+
     /**
      * v function
      * @note Register accessor named v0-vf in chip 8, 
@@ -0,0 +1,153 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_movie::chip8_movie( )
+    : header{ },
+    cycles{ },
+    events{ },
+    cursor{ 0 }
+{ }
+
+void chip8_movie::start(
+    const uint64_t rom_hash,
+    const uint64_t seed,
+    const echip8_random_modes random_mode,
+    const uint32_t instruction_per_second,
+    const uint8_t flags
+) {
+    header = { };
+
+    header.magic                  = Magic;
+    header.version                = Version;
+    header.random_mode            = random_mode;
+    header.rom_hash               = rom_hash;
+    header.seed                   = seed;
+    header.instruction_per_second = instruction_per_second;
+    header.flags                  = flags;
+
+    cycles.clear( );
+    events.clear( );
+
+    cursor = 0;
+}
+
+void chip8_movie::record( const uint64_t cycle, const chip8_input_event& event ) {
+    cycles.emplace_back( cycle );
+    events.emplace_back( event );
+}
+
+void chip8_movie::finish(
+    const uint64_t cycle,
+    const uint64_t screen_hash,
+    const uint64_t state_hash,
+    const echip8_states final_state
+) {
+    header.final_state = final_state;
+    header.cycles      = cycle;
+    header.screen_hash = screen_hash;
+    header.state_hash  = state_hash;
+    header.event_count = uint32_t( events.size( ) );
+}
+
+bool chip8_movie::save( chip8_string movie_path ) const {
+    auto records = std::vector<chip8_movie_event>( events.size( ) );
+    auto last    = uint64_t( 0 );
+
+    for ( auto event_id = size_t( 0 ); event_id < events.size( ); event_id++ ) {
+        const auto delta = cycles[ event_id ] - last;
+
+        if ( delta > UINT32_MAX )
+            return false;
+
+        records[ event_id ] = { uint32_t( delta ), events[ event_id ].key, uint8_t( events[ event_id ].pressed ), 0 };
+
+        last = cycles[ event_id ];
+    }
+
+    auto movie_file = std::ofstream( movie_path, std::ios::binary | std::ios::trunc );
+
+    movie_file.write( (const char*)&header, sizeof( header ) );
+    movie_file.write( (const char*)records.data( ), records.size( ) * sizeof( chip8_movie_event ) );
+
+    return movie_file.good( );
+}
+
+bool chip8_movie::load( chip8_string movie_path ) {
+    auto file = chip8_mapped_file{ };
+
+    if ( !file.open( movie_path ) || file.get_size( ) < sizeof( chip8_movie_header ) )
+        return false;
+
+    const auto* data = file.get_data( );
+    auto movie       = chip8_movie_header{ };
+
+    std::memcpy( &movie, data, sizeof( movie ) );
+
+    const auto is_valid =
+        movie.magic == Magic &&
+        movie.version == Version &&
+        file.get_size( ) == sizeof( movie ) + uint64_t( movie.event_count ) * sizeof( chip8_movie_event );
+
+    if ( !is_valid )
+        return false;
+
+    header = movie;
+
+    cycles.resize( header.event_count );
+    events.resize( header.event_count );
+
+    auto cycle = uint64_t( 0 );
+
+    for ( auto event_id = uint32_t( 0 ); event_id < header.event_count; event_id++ ) {
+        auto record = chip8_movie_event{ };
+
+        std::memcpy( &record, data + sizeof( movie ) + event_id * sizeof( record ), sizeof( record ) );
+
+        cycle += record.delta;
+
+        cycles[ event_id ] = cycle;
+        events[ event_id ] = { 0, record.key, record.pressed != 0 };
+    }
+
+    rewind( );
+
+    return true;
+}
+
+void chip8_movie::rewind( ) {
+    cursor = 0;
+}
+
+bool chip8_movie::next( const uint64_t cycle, chip8_input_event& event ) {
+    if ( is_finished( ) || cycle < cycles[ cursor ] )
+        return false;
+
+    event = events[ cursor++ ];
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_movie::validate(
+    const uint64_t cycle,
+    const uint64_t screen_hash,
+    const uint64_t state_hash
+) const {
+    return header.cycles == cycle && header.screen_hash == screen_hash && header.state_hash == state_hash;
+}
+
+bool chip8_movie::is_finished( ) const {
+    return cursor >= events.size( );
+}
+
+const chip8_movie_header& chip8_movie::get_header( ) const {
+    return header;
+}
+
+uint32_t chip8_movie::get_count( ) const {
+    return uint32_t( events.size( ) );
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "chip8_input_queue.h"
+
+/**
+ * Define movie file header.
+ * @field magic : Movie magic, chip8_movie::Magic.
+ * @field version : Movie format version.
+ * @field random_mode : Random generator mode.
+ * @field final_state : Execution state at the end of recording.
+ * @field rom_hash : Recorded ROM content hash.
+ * @field seed : Random generator seed.
+ * @field cycles : Instruction count at the end of recording.
+ * @field screen_hash : Screen buffer hash at the end of recording.
+ * @field state_hash : Registers and memory hash at the end of recording.
+ * @field instruction_per_second : Recorded speed, drive virtual timers.
+ * @field event_count : Key event count.
+ * @field flags : Recorded cpu options, quirks are replayed from it.
+ * @field reserved : Reserved, 0.
+ **/
+struct chip8_movie_header {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t random_mode;
+    uint8_t final_state;
+    uint64_t rom_hash;
+    uint64_t seed;
+    uint64_t cycles;
+    uint64_t screen_hash;
+    uint64_t state_hash;
+    uint32_t instruction_per_second;
+    uint32_t event_count;
+    uint32_t flags;
+    uint32_t reserved;
+};
+
+/**
+ * Define movie file key event.
+ * @field delta : Instruction count since previous event.
+ * @field key : Event key.
+ * @field pressed : 1 for key down, 0 for key up.
+ * @field reserved : Reserved, 0.
+ **/
+struct chip8_movie_event {
+    uint32_t delta;
+    uint8_t key;
+    uint8_t pressed;
+    uint16_t reserved;
+};
+
+static_assert( sizeof( chip8_movie_header ) == 64 );
+static_assert( sizeof( chip8_movie_event ) == 8 );
+
+/**
+ * chip8_movie class
+ * @note Record key events against the instruction count, with the
+ *       random seed and final machine hashes, so a run can be 
+ *       replayed exactly and validated at full interpreter speed.
+ **/
+class chip8_movie final {
+
+public:
+    static constexpr uint32_t Magic   = 0x564D3843;
+    static constexpr uint16_t Version = 2;
+
+private:
+    chip8_movie_header header;
+    std::vector<uint64_t> cycles;
+    std::vector<chip8_input_event> events;
+    uint32_t cursor;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_movie( );
+
+    /**
+     * start method
+     * @note Clear the movie and start a recording.
+     * @param rom_hash : Recorded ROM content hash.
+     * @param seed : Random generator seed.
+     * @param random_mode : Random generator mode.
+     * @param instruction_per_second : Recorded speed.
+     * @param flags : Recorded cpu options.
+     **/
+    void start(
+        const uint64_t rom_hash,
+        const uint64_t seed,
+        const echip8_random_modes random_mode,
+        const uint32_t instruction_per_second,
+        const uint8_t flags
+    );
+
+    /**
+     * record method
+     * @note Record a key event applied at an instruction count.
+     * @param cycle : Instruction count when the event was applied.
+     * @param event : Applied key event.
+     **/
+    void record( const uint64_t cycle, const chip8_input_event& event );
+
+    /**
+     * finish method
+     * @note End a recording with final machine hashes.
+     * @param cycle : Final instruction count.
+     * @param screen_hash : Final screen buffer hash.
+     * @param state_hash : Final registers and memory hash.
+     * @param final_state : Final execution state.
+     **/
+    void finish(
+        const uint64_t cycle,
+        const uint64_t screen_hash,
+        const uint64_t state_hash,
+        const echip8_states final_state
+    );
+
+    /**
+     * save function
+     * @note Write the movie file.
+     * @param movie_path : Target movie file path.
+     * @return True when the file is written.
+     **/
+    bool save( chip8_string movie_path ) const;
+
+    /**
+     * load function
+     * @note Read a movie file and rewind it.
+     * @param movie_path : Source movie file path.
+     * @return True when the file is a valid movie.
+     **/
+    bool load( chip8_string movie_path );
+
+    /**
+     * rewind method
+     * @note Restart playback from first event.
+     **/
+    void rewind( );
+
+    /**
+     * next function
+     * @note Pop next event due at an instruction count.
+     * @param cycle : Current instruction count.
+     * @param event : Event output.
+     * @return True when an event is due.
+     **/
+    bool next( const uint64_t cycle, chip8_input_event& event );
+
+public:
+    /**
+     * validate function
+     * @note Compare final machine hashes to recorded ones.
+     * @param cycle : Final instruction count.
+     * @param screen_hash : Final screen buffer hash.
+     * @param state_hash : Final registers and memory hash.
+     * @return True when the replay matches the recording.
+     **/
+    bool validate(
+        const uint64_t cycle,
+        const uint64_t screen_hash,
+        const uint64_t state_hash
+    ) const;
+
+    /**
+     * is_finished function
+     * @note Get if all events were replayed.
+     * @return True when no event is left.
+     **/
+    bool is_finished( ) const;
+
+    /**
+     * get_header function
+     * @note Get movie header.
+     * @return Reference to movie header.
+     **/
+    const chip8_movie_header& get_header( ) const;
+
+    /**
+     * get_count function
+     * @note Get recorded event count.
+     * @return Event count.
+     **/
+    uint32_t get_count( ) const;
+
+};
@@ -0,0 +1,129 @@
+#include "chip8.h"
+
+#ifndef WINDOWS
+#   include <cerrno>
+#   include <time.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_pacer::chip8_pacer( )
+    : frame_budget{ 0 },
+    frame_remainder{ 0 },
+    budget{ 0 },
+    remainder{ 0 },
+    deadline{ },
+    stats{ }
+{ }
+
+void chip8_pacer::start( const uint32_t instruction_per_second ) {
+    frame_budget    = instruction_per_second / 60;
+    frame_remainder = instruction_per_second % 60;
+    remainder       = 0;
+    deadline        = clock_t::now( ) + Period;
+
+    refill( );
+}
+
+bool chip8_pacer::consume( ) {
+    if ( budget > 0 )
+        budget -= 1;
+
+    return budget == 0;
+}
+
+void chip8_pacer::wait( ) {
+    // Below 60 instructions per second some frames get no budget, the
+    // fraction is carried and those frames are slept through.
+    do {
+        wait_frame( );
+    } while ( budget == 0 && frame_remainder > 0 );
+}
+
+void chip8_pacer::reset_stats( ) {
+    stats = { };
+}
+
+void chip8_pacer::dump( ) const {
+    printf( 
+        "Frames   %10" PRIu64 "\nOverruns %10" PRIu64 "\nJitter   %10" PRId64 " us mean %" PRId64 " us max\nSleep    %10" PRId64 " ms\n",
+        stats.frames,
+        stats.overruns,
+        get_jitter_mean( ) / 1000,
+        stats.jitter_max / 1000,
+        stats.sleep_time / 1000000
+    );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_pacer::wait_frame( ) {
+    const auto sleep_start = clock_t::now( );
+
+    if ( sleep_start < deadline ) {
+        sleep_until( deadline );
+
+        const auto wake_up = clock_t::now( );
+        const auto jitter  = std::chrono::duration_cast<std::chrono::nanoseconds>( wake_up - deadline ).count( );
+
+        stats.sleeps       += 1;
+        stats.jitter_total += jitter;
+        stats.jitter_max    = std::max( stats.jitter_max, jitter );
+        stats.sleep_time   += std::chrono::duration_cast<std::chrono::nanoseconds>( wake_up - sleep_start ).count( );
+
+        auto& events = chip8_event_trace::get( );
+
+        if ( events.is_enabled( ) ) {
+            const auto start = std::chrono::duration_cast<std::chrono::nanoseconds>( sleep_start.time_since_epoch( ) ).count( );
+
+            events.complete( "sleep", "pacer", start, 0, uint32_t( std::max( jitter, int64_t( 0 ) ) ) );
+        }
+    } else if ( deadline + Period < sleep_start ) {
+        stats.overruns += 1;
+
+        deadline = sleep_start;
+    }
+
+    stats.frames += 1;
+    deadline     += Period;
+
+    refill( );
+}
+
+void chip8_pacer::sleep_until( const clock_t::time_point time_point ) const {
+#ifdef WINDOWS
+    std::this_thread::sleep_until( time_point );
+#else
+    // steady_clock is CLOCK_MONOTONIC, time points are comparable.
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>( time_point.time_since_epoch( ) ).count( );
+    const auto target      = timespec{ time_t( nanoseconds / 1000000000 ), long( nanoseconds % 1000000000 ) };
+
+    while ( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr ) == EINTR );
+#endif
+}
+
+void chip8_pacer::refill( ) {
+    budget     = frame_budget;
+    remainder += frame_remainder;
+
+    if ( remainder >= 60 ) {
+        remainder -= 60;
+        budget    += 1;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const chip8_pacer_stats& chip8_pacer::get_stats( ) const {
+    return stats;
+}
+
+int64_t chip8_pacer::get_jitter_mean( ) const {
+    if ( stats.sleeps == 0 )
+        return 0;
+
+    return stats.jitter_total / int64_t( stats.sleeps );
+}
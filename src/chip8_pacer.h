@@ -0,0 +1,124 @@
+#pragma once
+
+#include "chip8_timer_service.h"
+
+/**
+ * Define pacing statistics, durations are in nanoseconds.
+ * @field frames : Completed frame count.
+ * @field overruns : Frame count that ended after the next deadline.
+ * @field sleeps : Frame count that slept to their deadline.
+ * @field jitter_total : Sum of wake up delay past deadlines.
+ * @field jitter_max : Largest wake up delay past a deadline.
+ * @field sleep_time : Total time spent sleeping.
+ **/
+struct chip8_pacer_stats {
+    uint64_t frames;
+    uint64_t overruns;
+    uint64_t sleeps;
+    int64_t jitter_total;
+    int64_t jitter_max;
+    int64_t sleep_time;
+};
+
+/**
+ * chip8_pacer class
+ * @note Pace execution to 60Hz frames, each frame get an even 
+ *       share of the instruction per second budget and the pacer
+ *       sleeps to the absolute frame deadline, so sleep error
+ *       never accumulate.
+ **/
+class chip8_pacer final {
+
+    using clock_t = std::chrono::steady_clock;
+
+public:
+    static constexpr auto Period = std::chrono::nanoseconds( 1000000000 / 60 );
+
+private:
+    uint32_t frame_budget;
+    uint32_t frame_remainder;
+    uint32_t budget;
+    uint32_t remainder;
+    clock_t::time_point deadline;
+    chip8_pacer_stats stats;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_pacer( );
+
+    /**
+     * start method
+     * @note Start pacing, first frame deadline is one period
+     *       from now.
+     * @param instruction_per_second : Instruction budget per second.
+     **/
+    void start( const uint32_t instruction_per_second );
+
+    /**
+     * consume function
+     * @note Consume one instruction from current frame budget.
+     * @return True when frame budget is exhausted, wait must be called.
+     **/
+    bool consume( );
+
+    /**
+     * wait method
+     * @note End current frame, sleep to its deadline and refill the
+     *       budget, frames without budget are slept through. When the
+     *       deadline is already a period late the pacer resync to now
+     *       instead of bursting to catch up.
+     **/
+    void wait( );
+
+    /**
+     * reset_stats method
+     * @note Clear pacing statistics.
+     **/
+    void reset_stats( );
+
+    /**
+     * dump method
+     * @note Dump pacing statistics.
+     **/
+    void dump( ) const;
+
+private:
+    /**
+     * wait_frame method
+     * @note End current frame, sleep to its deadline and refill the
+     *       budget.
+     **/
+    void wait_frame( );
+
+    /**
+     * sleep_until method
+     * @note Sleep to an absolute time point.
+     * @param time_point : Target wake up time point.
+     **/
+    void sleep_until( const clock_t::time_point time_point ) const;
+
+    /**
+     * refill method
+     * @note Refill frame budget, fraction of instruction per frame
+     *       are carried to following frames.
+     **/
+    void refill( );
+
+public:
+    /**
+     * get_stats function
+     * @note Get pacing statistics.
+     * @return Reference to pacing statistics.
+     **/
+    const chip8_pacer_stats& get_stats( ) const;
+
+    /**
+     * get_jitter_mean function
+     * @note Get mean wake up delay past deadlines.
+     * @return Mean jitter in nanoseconds.
+     **/
+    int64_t get_jitter_mean( ) const;
+
+};
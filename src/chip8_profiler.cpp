@@ -0,0 +1,217 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_profiler::chip8_profiler( )
+    : period{ 0 },
+    countdown{ 0 },
+    sample_count{ 0 },
+    hits{ },
+    frames{ },
+    stacks{ },
+    labels{ }
+{ }
+
+void chip8_profiler::start( const uint32_t sample_period ) {
+    period    = std::max( sample_period, uint32_t( 1 ) );
+    countdown = period;
+
+    hits.assign( chip8_memory_manager_unit::Capacity, 0 );
+    frames.reserve( chip8_stack_mananger::Capacity + 2 );
+
+    reset( );
+}
+
+void chip8_profiler::stop( ) {
+    period = 0;
+}
+
+void chip8_profiler::reset( ) {
+    sample_count = 0;
+
+    std::fill( hits.begin( ), hits.end( ), 0 );
+    stacks.clear( );
+}
+
+void chip8_profiler::tick(
+    const chip8_memory_manager_unit& mmu,
+    const uint16_t cpu_pc
+) {
+    if ( period == 0 || --countdown > 0 )
+        return;
+
+    countdown = period;
+
+    sample( mmu, cpu_pc );
+}
+
+bool chip8_profiler::load_labels( chip8_string labels_path ) {
+    auto labels_file = std::ifstream( labels_path );
+
+    if ( !labels_file.is_open( ) )
+        return false;
+
+    auto line = std::string{ };
+
+    labels.clear( );
+
+    while ( std::getline( labels_file, line ) ) {
+        const auto comment = line.find_first_of( "#;" );
+
+        if ( comment != std::string::npos )
+            line.resize( comment );
+
+        auto name    = std::array<char, 128>{ };
+        auto address = 0u;
+
+        if ( sscanf( line.c_str( ), "%x %127s", &address, name.data( ) ) == 2 && address < chip8_memory_manager_unit::Capacity )
+            labels.push_back( { uint16_t( address ), name.data( ) } );
+    }
+
+    auto by_address = []( const chip8_profiler_label& left, const chip8_profiler_label& right ) -> bool {
+        return left.address < right.address;
+    };
+
+    std::stable_sort( labels.begin( ), labels.end( ), by_address );
+
+    return true;
+}
+
+bool chip8_profiler::write( chip8_string profile_path ) const {
+    auto* profile_file = fopen( profile_path, "w" );
+
+    if ( !profile_file )
+        return false;
+
+    // Symbolized stacks can merge, each function is one frame.
+    auto collapsed = std::map<std::string, uint64_t>{ };
+
+    for ( const auto& [ stack, count ] : stacks ) {
+        auto line  = std::string{ };
+        auto frame = std::string{ };
+
+        for ( const auto address : stack ) {
+            auto name = symbolize( address, false );
+
+            // Leaf inside a labelled function is the function frame.
+            if ( name == frame )
+                continue;
+
+            if ( !line.empty( ) )
+                line.push_back( ';' );
+
+            line.append( name );
+
+            frame = std::move( name );
+        }
+
+        collapsed[ line ] += count;
+    }
+
+    for ( const auto& [ line, count ] : collapsed )
+        fprintf( profile_file, "%s %" PRIu64 "\n", line.c_str( ), count );
+
+    return fclose( profile_file ) == 0;
+}
+
+void chip8_profiler::dump( ) const {
+    printf( "> Profiler : %" PRIu64 " samples, 1/%u, %zu stacks\n", sample_count, period, stacks.size( ) );
+
+    auto hot_spots = std::vector<uint16_t>{ };
+
+    for ( auto address = uint16_t( 0 ); address < hits.size( ); address++ ) {
+        if ( hits[ address ] > 0 )
+            hot_spots.emplace_back( address );
+    }
+
+    auto by_hits = [ this ]( const uint16_t left, const uint16_t right ) -> bool {
+        return hits[ left ] > hits[ right ];
+    };
+
+    std::stable_sort( hot_spots.begin( ), hot_spots.end( ), by_hits );
+
+    hot_spots.resize( std::min( hot_spots.size( ), size_t( 16 ) ) );
+
+    for ( const auto address : hot_spots ) {
+        const auto share = 100.0 * double( hits[ address ] ) / double( sample_count );
+
+        printf( "[ 0x%03X ] %6.2f%% %s\n", address, share, symbolize( address, true ).c_str( ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_profiler::sample(
+    const chip8_memory_manager_unit& mmu,
+    const uint16_t cpu_pc
+) {
+    const auto& stack       = mmu.get_stack( );
+    const auto* rom_memory  = mmu.get_rom_memory( );
+    const auto stack_depth  = stack.get_depth( );
+    const auto leaf_address = uint16_t( ( cpu_pc + eca_rom_start ) & ( chip8_memory_manager_unit::Capacity - 1 ) );
+
+    frames.clear( );
+    frames.emplace_back( eca_rom_start );
+
+    for ( auto stack_id = uint8_t( 0 ); stack_id < stack_depth; stack_id++ ) {
+        const auto call_pc = uint16_t( stack.get( stack_id ) - 2 );
+
+        if ( call_pc + eca_rom_start + 1 >= chip8_memory_manager_unit::Capacity )
+            continue;
+
+        const auto instruction = uint16_t( ( rom_memory[ call_pc ] << 8 ) | rom_memory[ call_pc + 1 ] );
+        const auto callee      = uint16_t( ( instruction & 0x0FFF ) + eca_rom_start );
+
+        frames.emplace_back( callee & ( chip8_memory_manager_unit::Capacity - 1 ) );
+    }
+
+    frames.emplace_back( leaf_address );
+
+    hits[ leaf_address ] += 1;
+    sample_count         += 1;
+
+    auto stack_sample = stacks.find( frames );
+
+    if ( stack_sample != stacks.end( ) )
+        stack_sample->second += 1;
+    else
+        stacks.emplace( frames, 1 );
+}
+
+std::string chip8_profiler::symbolize( const uint16_t address, const bool use_offset ) const {
+    auto buffer = std::array<char, 160>{ };
+
+    auto by_address = []( const uint16_t address, const chip8_profiler_label& label ) -> bool {
+        return address < label.address;
+    };
+
+    const auto label = std::upper_bound( labels.begin( ), labels.end( ), address, by_address );
+
+    if ( label == labels.begin( ) ) {
+        snprintf( buffer.data( ), buffer.size( ), "0x%03X", address );
+
+        return buffer.data( );
+    }
+
+    const auto& owner = *std::prev( label );
+
+    if ( !use_offset || owner.address == address )
+        return owner.name;
+
+    snprintf( buffer.data( ), buffer.size( ), "%s+0x%X", owner.name.c_str( ), address - owner.address );
+
+    return buffer.data( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_profiler::is_enabled( ) const {
+    return period > 0;
+}
+
+uint64_t chip8_profiler::get_sample_count( ) const {
+    return sample_count;
+}
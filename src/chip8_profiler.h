@@ -0,0 +1,133 @@
+#pragma once
+
+#include "chip8_machine_arena.h"
+
+/**
+ * Define a profiler label, loaded from a label file.
+ * @field address : Label memory address.
+ * @field name : Label name.
+ **/
+struct chip8_profiler_label {
+    uint16_t address;
+    std::string name;
+};
+
+/**
+ * chip8_profiler class
+ * @note Sample the emulated PC and call stack every N instructions,
+ *       aggregate samples per stack and write collapsed stacks for
+ *       flame graph tools. Each call frame is the subroutine entry
+ *       read back from the 2NNN before the return address.
+ **/
+class chip8_profiler final {
+
+public:
+    static constexpr uint32_t DefaultPeriod = 997;
+
+private:
+    uint32_t period;
+    uint32_t countdown;
+    uint64_t sample_count;
+    std::vector<uint32_t> hits;
+    std::vector<uint16_t> frames;
+    std::map<std::vector<uint16_t>, uint64_t> stacks;
+    std::vector<chip8_profiler_label> labels;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_profiler( );
+
+    /**
+     * start method
+     * @note Enable sampling and clear previous samples.
+     * @param sample_period : Instruction count between samples, prime
+     *                        periods avoid aliasing with ROM loops.
+     **/
+    void start( const uint32_t sample_period = DefaultPeriod );
+
+    /**
+     * stop method
+     * @note Disable sampling, samples are kept.
+     **/
+    void stop( );
+
+    /**
+     * reset method
+     * @note Clear samples.
+     **/
+    void reset( );
+
+    /**
+     * tick method
+     * @note Count an instruction, sample once per period.
+     * @param mmu : Reference to current memory management unit.
+     * @param cpu_pc : Current PC, relative to ROM start.
+     **/
+    void tick(
+        const chip8_memory_manager_unit& mmu,
+        const uint16_t cpu_pc
+    );
+
+    /**
+     * load_labels function
+     * @note Load a label file, one "address name" per line with
+     *       address in hexadecimal, '#' or ';' start a comment.
+     * @param labels_path : Target label file path.
+     * @return True when the file was read.
+     **/
+    bool load_labels( chip8_string labels_path );
+
+    /**
+     * write function
+     * @note Write collapsed stacks, one "frame;frame;leaf count"
+     *       per line, usable by flamegraph.pl or speedscope.
+     * @param profile_path : Target file path.
+     * @return True when the file was written.
+     **/
+    bool write( chip8_string profile_path ) const;
+
+    /**
+     * dump method
+     * @note Dump sample count and hottest addresses.
+     **/
+    void dump( ) const;
+
+private:
+    /**
+     * sample method
+     * @note Record current PC and call stack.
+     * @param mmu : Reference to current memory management unit.
+     * @param cpu_pc : Current PC, relative to ROM start.
+     **/
+    void sample(
+        const chip8_memory_manager_unit& mmu,
+        const uint16_t cpu_pc
+    );
+
+    /**
+     * symbolize function
+     * @note Get the name of an address from labels.
+     * @param address : Target memory address.
+     * @param use_offset : True to append offset from the label.
+     * @return Label name, label+offset or hexadecimal address.
+     **/
+    std::string symbolize( const uint16_t address, const bool use_offset ) const;
+
+public:
+    /**
+     * is_enabled function
+     * @note Get if sampling is enabled.
+     * @return True when enabled.
+     **/
+    bool is_enabled( ) const;
+
+    /**
+     * get_sample_count function
+     * @note Get recorded sample count.
+     * @return Sample count.
+     **/
+    uint64_t get_sample_count( ) const;
+
+};
@@ -5,27 +5,89 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 chip8_rom_manager_unit::chip8_rom_manager_unit( )
     : size{ 0 },
-    path{ "" }
+    path{ "" },
+    instruction_per_second{ 0 },
+    hash{ 0 }
 { }
 
 bool chip8_rom_manager_unit::load( 
     chip8_memory_manager_unit& mmu,
     chip8_string rom_path
 ) {
+    size = 0;
+    path = rom_path;
+
+    instruction_per_second = 0;
+    hash                   = 0;
+
     if ( std::filesystem::is_regular_file( rom_path ) ) {
-        size = uint16_t( std::filesystem::file_size( rom_path ) );
+        const auto file_size = std::filesystem::file_size( rom_path );
 
-        if ( size > 0 ) {
+        if ( file_size > 0 && file_size <= Capacity ) {
             auto* rom_memory = (char*)mmu.get_rom_memory( );
             auto rom_file    = std::ifstream( rom_path, std::ios::binary );
 
+            size = uint16_t( file_size );
+
             rom_file.read( rom_memory, size );
+
+            hash = chip8_hash( (const uint8_t*)rom_memory, size );
+
+            mmu.mark_dirty( eca_rom_start, size );
         }
     }
 
     return size > 0;
 }
 
+bool chip8_rom_manager_unit::load(
+    chip8_memory_manager_unit& mmu,
+    const uint8_t* rom_data,
+    const uint16_t rom_size,
+    chip8_string rom_name
+) {
+    size = 0;
+    path = rom_name;
+
+    instruction_per_second = 0;
+    hash                   = 0;
+
+    if ( rom_data && rom_size > 0 && rom_size <= Capacity ) {
+        auto* rom_memory = mmu.get_rom_memory( );
+
+        size = rom_size;
+
+        std::memcpy( rom_memory, rom_data, size );
+
+        hash = chip8_hash( rom_data, size );
+
+        mmu.mark_dirty( eca_rom_start, size );
+    }
+
+    return size > 0;
+}
+
+void chip8_rom_manager_unit::set_instruction_per_second( const uint32_t value ) {
+    instruction_per_second = value;
+}
+
+void chip8_rom_manager_unit::save_state( chip8_machine_state& state ) const {
+    state.rom_size                   = size;
+    state.rom_hash                   = hash;
+    state.rom_instruction_per_second = instruction_per_second;
+}
+
+void chip8_rom_manager_unit::load_state( const chip8_machine_state& state ) {
+    // Names belong to the library that loaded the ROM, never to the state.
+    if ( state.rom_hash != hash )
+        path = "";
+
+    size = std::min( state.rom_size, Capacity );
+    hash = state.rom_hash;
+
+    instruction_per_second = state.rom_instruction_per_second;
+}
+
 void chip8_rom_manager_unit::dump( const chip8_memory_manager_unit& mmu ) const {
     mmu.dump_rom( size );
 }
@@ -53,11 +115,19 @@ chip8_string chip8_rom_manager_unit::get_path( ) const {
     return exist( ) ? path : "";
 }
 
+uint32_t chip8_rom_manager_unit::get_instruction_per_second( ) const {
+    return instruction_per_second;
+}
+
+uint64_t chip8_rom_manager_unit::get_hash( ) const {
+    return hash;
+}
+
 uint16_t chip8_rom_manager_unit::fetch(
     chip8_memory_manager_unit& mmu,
     const uint16_t cpu_pc
 ) const {
-    const auto* rom_memory = (char*)mmu.get_rom_memory( );
+    const auto* rom_memory = mmu.get_rom_memory( );
 
     return uint16_t( ( rom_memory[ cpu_pc ] << 8 ) | rom_memory[ cpu_pc + 1 ] );
 }
@@ -8,9 +8,14 @@
  **/
 class chip8_rom_manager_unit final {
 
+public:
+    static constexpr uint16_t Capacity = eca_rom_stop - eca_rom_start + 1;
+
 private:
     uint16_t size;
     chip8_string path;
+    uint32_t instruction_per_second;
+    uint64_t hash;
 
 public:
     /**
@@ -30,6 +35,46 @@ public:
         chip8_string rom_path
     );
 
+    /**
+     * load function
+     * @note Load ROM bytes already in memory, with a single bounded
+     *       copy and no filesystem access.
+     * @param mpu : Reference to current memory manager unit.
+     * @param rom_data : Target ROM bytes.
+     * @param rom_size : Target ROM size in bytes.
+     * @param rom_name : Target ROM name, must outlive the execution.
+     * @return True when ROM load succeded.
+     **/
+    bool load(
+        chip8_memory_manager_unit& mmu,
+        const uint8_t* rom_data,
+        const uint16_t rom_size,
+        chip8_string rom_name
+    );
+
+    /**
+     * set_instruction_per_second method
+     * @note Set current ROM speed, defined by ROM bundle.
+     * @param value : Target ROM speed, 0 for default.
+     **/
+    void set_instruction_per_second( const uint32_t value );
+
+    /**
+     * save_state method
+     * @note Copy ROM size, content hash and speed to a machine state.
+     * @param state : Target machine state.
+     **/
+    void save_state( chip8_machine_state& state ) const;
+
+    /**
+     * load_state method
+     * @note Copy ROM size, content hash and speed from a machine
+     *       state, ROM bytes are part of the state memory. The name
+     *       is kept only when the state was saved from the same ROM.
+     * @param state : Source machine state.
+     **/
+    void load_state( const chip8_machine_state& state );
+
     /**
      * dump method
      * @note Dump the entire ROM content.
@@ -69,6 +114,20 @@ public:
      **/
     chip8_string get_path( ) const;
 
+    /**
+     * get_instruction_per_second function
+     * @note Get current ROM speed.
+     * @return ROM speed or 0 for default.
+     **/
+    uint32_t get_instruction_per_second( ) const;
+
+    /**
+     * get_hash function
+     * @note Get content hash of the ROM as it was loaded.
+     * @return ROM content hash.
+     **/
+    uint64_t get_hash( ) const;
+
     /**
      * fetch function
      * @note Fetch instruction from ROM.
@@ -0,0 +1,210 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_rom_bundle::chip8_rom_bundle( )
+    : roms{ },
+    datas{ },
+    data_ids{ },
+    rom_ids{ }
+{ }
+
+bool chip8_rom_bundle::add(
+    chip8_string rom_name,
+    const uint8_t* rom_data,
+    const size_t rom_size,
+    const uint8_t quirks,
+    const uint32_t instruction_per_second
+) {
+    if ( !rom_data || rom_size == 0 || rom_size > chip8_rom_manager_unit::Capacity )
+        return false;
+
+    const auto rom_hash = chip8_hash( rom_data, rom_size );
+    const auto [ rom_id, is_new_rom ] = rom_ids.try_emplace( rom_name, uint32_t( roms.size( ) ) );
+
+    // Same name twice is only accepted when nothing would be lost.
+    if ( !is_new_rom ) {
+        const auto& rom = roms[ rom_id->second ];
+
+        if ( rom.hash == rom_hash && rom.quirks == quirks && rom.instruction_per_second == instruction_per_second )
+            return true;
+
+        printf( "> Conflicting duplicate ROM : %s\n", rom_name );
+
+        return false;
+    }
+
+    const auto [ data_id, is_new_data ] = data_ids.try_emplace( rom_hash, uint32_t( datas.size( ) ) );
+
+    if ( is_new_data )
+        datas.emplace_back( rom_data, rom_data + rom_size );
+
+    roms.push_back( {
+        rom_name,
+        data_id->second,
+        rom_hash,
+        instruction_per_second,
+        quirks
+    } );
+
+    return true;
+}
+
+bool chip8_rom_bundle::add(
+    chip8_string rom_path,
+    const uint8_t quirks,
+    const uint32_t instruction_per_second
+) {
+    auto file = chip8_mapped_file{ };
+
+    if ( !file.open( rom_path ) )
+        return false;
+
+    const auto rom_name = std::filesystem::path( rom_path ).filename( ).string( );
+
+    return add( rom_name.c_str( ), file.get_data( ), file.get_size( ), quirks, instruction_per_second );
+}
+
+bool chip8_rom_bundle::write( chip8_string bundle_path ) const {
+    auto by_hash = []( const chip8_bundle_rom* left, const chip8_bundle_rom* right ) -> bool {
+        return left->hash < right->hash;
+    };
+
+    auto sorted_roms = std::vector<const chip8_bundle_rom*>{ };
+
+    for ( const auto& rom : roms )
+        sorted_roms.emplace_back( &rom );
+
+    std::sort( sorted_roms.begin( ), sorted_roms.end( ), by_hash );
+
+    const auto rom_count = uint32_t( sorted_roms.size( ) );
+    auto records         = std::vector<chip8_bundle_record>( rom_count );
+    auto name_index      = std::vector<uint32_t>( rom_count );
+    auto names           = std::string{ };
+    auto data            = std::vector<uint8_t>{ };
+    auto data_offsets    = std::vector<uint32_t>( datas.size( ) );
+
+    for ( auto data_id = size_t( 0 ); data_id < datas.size( ); data_id++ ) {
+        data_offsets[ data_id ] = uint32_t( data.size( ) );
+
+        data.insert( data.end( ), datas[ data_id ].begin( ), datas[ data_id ].end( ) );
+    }
+
+    for ( auto rom_id = uint32_t( 0 ); rom_id < rom_count; rom_id++ ) {
+        const auto* rom = sorted_roms[ rom_id ];
+        auto& record    = records[ rom_id ];
+
+        record.hash                   = rom->hash;
+        record.name_offset            = uint32_t( names.size( ) );
+        record.data_offset            = data_offsets[ rom->data_id ];
+        record.instruction_per_second = rom->instruction_per_second;
+        record.size                   = uint16_t( datas[ rom->data_id ].size( ) );
+        record.quirks                 = rom->quirks;
+        record.reserved               = 0;
+
+        names.append( rom->name );
+        names.push_back( '\0' );
+
+        name_index[ rom_id ] = rom_id;
+    }
+
+    auto by_name = [ & ]( const uint32_t left, const uint32_t right ) -> bool {
+        return sorted_roms[ left ]->name < sorted_roms[ right ]->name;
+    };
+
+    std::sort( name_index.begin( ), name_index.end( ), by_name );
+
+    auto header = chip8_bundle_header{ };
+
+    header.magic             = Magic;
+    header.version           = Version;
+    header.record_size       = uint16_t( sizeof( chip8_bundle_record ) );
+    header.rom_count         = rom_count;
+    header.records_offset    = uint32_t( sizeof( chip8_bundle_header ) );
+    header.name_index_offset = header.records_offset + rom_count * sizeof( chip8_bundle_record );
+    header.names_offset      = header.name_index_offset + rom_count * sizeof( uint32_t );
+    header.data_offset       = header.names_offset + uint32_t( names.size( ) );
+    header.file_size         = header.data_offset + uint32_t( data.size( ) );
+
+    auto bundle_file = std::ofstream( bundle_path, std::ios::binary | std::ios::trunc );
+
+    bundle_file.write( (const char*)&header, sizeof( header ) );
+    bundle_file.write( (const char*)records.data( ), records.size( ) * sizeof( chip8_bundle_record ) );
+    bundle_file.write( (const char*)name_index.data( ), name_index.size( ) * sizeof( uint32_t ) );
+    bundle_file.write( names.data( ), names.size( ) );
+    bundle_file.write( (const char*)data.data( ), data.size( ) );
+
+    return bundle_file.good( );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const chip8_bundle_header* chip8_rom_bundle::validate(
+    const uint8_t* data,
+    const size_t size
+) {
+    if ( !data || size < sizeof( chip8_bundle_header ) )
+        return nullptr;
+
+    const auto* header = (const chip8_bundle_header*)data;
+    const auto rom_count = uint64_t( header->rom_count );
+
+    const auto is_valid =
+        header->magic == Magic &&
+        header->version == Version &&
+        header->record_size == sizeof( chip8_bundle_record ) &&
+        header->file_size == size &&
+        header->records_offset + rom_count * sizeof( chip8_bundle_record ) <= header->name_index_offset &&
+        header->name_index_offset + rom_count * sizeof( uint32_t ) <= header->names_offset &&
+        header->names_offset <= header->data_offset &&
+        header->data_offset <= size;
+
+    if ( !is_valid )
+        return nullptr;
+
+    const auto* records    = (const chip8_bundle_record*)( data + header->records_offset );
+    const auto* name_index = (const uint32_t*)( data + header->name_index_offset );
+    const auto names_size  = header->data_offset - header->names_offset;
+    const auto data_size   = size - header->data_offset;
+
+    for ( auto rom_id = uint32_t( 0 ); rom_id < header->rom_count; rom_id++ ) {
+        const auto& record = records[ rom_id ];
+
+        if ( record.size == 0 || record.size > chip8_rom_manager_unit::Capacity )
+            return nullptr;
+
+        if ( record.name_offset >= names_size || uint64_t( record.data_offset ) + record.size > data_size )
+            return nullptr;
+
+        if ( name_index[ rom_id ] >= header->rom_count )
+            return nullptr;
+    }
+
+    if ( header->rom_count > 0 && data[ header->data_offset - 1 ] != '\0' )
+        return nullptr;
+
+    // Lookups binary search both tables, names are terminated above.
+    const auto* names = (chip8_string)( data + header->names_offset );
+
+    for ( auto rom_id = uint32_t( 1 ); rom_id < header->rom_count; rom_id++ ) {
+        if ( records[ rom_id - 1 ].hash > records[ rom_id ].hash )
+            return nullptr;
+
+        const auto& previous = records[ name_index[ rom_id - 1 ] ];
+        const auto& current  = records[ name_index[ rom_id ] ];
+
+        if ( std::strcmp( names + previous.name_offset, names + current.name_offset ) > 0 )
+            return nullptr;
+    }
+
+    return header;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t chip8_rom_bundle::get_count( ) const {
+    return uint32_t( roms.size( ) );
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "chip8_mapped_file.h"
+
+/**
+ * Define all ROM quirk flags stored in bundle.
+ **/
+enum echip8_rom_quirks : uint8_t {
+    ecq_none        = 0x00,
+    ecq_legacy_set  = 0x01, // Legacy shift quirk is defined
+    ecq_legacy_on   = 0x02, // Legacy shift quirk value
+    ecq_stack_set   = 0x04, // Stack limit quirk is defined
+    ecq_stack_limit = 0x08  // Stack limit quirk value
+};
+
+/**
+ * Define ROM bundle file header, the bundle layout is :
+ * header | records sorted by hash | name index sorted by name |
+ * names | ROM bytes. Records of identical content share their
+ * ROM bytes. All values are little endian.
+ * @field magic : Bundle magic, chip8_rom_bundle::Magic.
+ * @field version : Bundle format version.
+ * @field record_size : Size of one record in bytes.
+ * @field rom_count : Count of ROM in the bundle.
+ * @field records_offset : Records table offset from file start.
+ * @field name_index_offset : Name index offset from file start.
+ * @field names_offset : Names table offset from file start.
+ * @field data_offset : ROM bytes offset from file start.
+ * @field file_size : Total bundle size in bytes.
+ **/
+struct chip8_bundle_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t rom_count;
+    uint32_t records_offset;
+    uint32_t name_index_offset;
+    uint32_t names_offset;
+    uint32_t data_offset;
+    uint32_t file_size;
+};
+
+/**
+ * Define ROM bundle record.
+ * @field hash : ROM content hash.
+ * @field name_offset : ROM name offset from names table.
+ * @field data_offset : ROM bytes offset from data section.
+ * @field instruction_per_second : ROM speed, 0 for default.
+ * @field size : ROM size in bytes.
+ * @field quirks : ROM quirks flags from echip8_rom_quirks.
+ * @field reserved : Padding, always 0.
+ **/
+struct chip8_bundle_record {
+    uint64_t hash;
+    uint32_t name_offset;
+    uint32_t data_offset;
+    uint32_t instruction_per_second;
+    uint16_t size;
+    uint8_t quirks;
+    uint8_t reserved;
+};
+
+/**
+ * chip8_rom_bundle class
+ * @note Build ROM bundle files, reading is done in place by
+ *       chip8_rom_library from the mapped file.
+ **/
+class chip8_rom_bundle final {
+
+public:
+    static constexpr uint32_t Magic   = 0x42523843; // "C8RB"
+    static constexpr uint16_t Version = 1;
+
+private:
+    /**
+     * chip8_bundle_rom struct
+     * @note Define a ROM waiting to be written, ROM with the same
+     *       content share one data block.
+     **/
+    struct chip8_bundle_rom {
+        std::string name;
+        uint32_t data_id;
+        uint64_t hash;
+        uint32_t instruction_per_second;
+        uint8_t quirks;
+    };
+
+private:
+    std::vector<chip8_bundle_rom> roms;
+    std::vector<std::vector<uint8_t>> datas;
+    std::unordered_map<uint64_t, uint32_t> data_ids;
+    std::unordered_map<std::string, uint32_t> rom_ids;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_rom_bundle( );
+
+    /**
+     * add function
+     * @note Add ROM bytes to the bundle, duplicated content is
+     *       stored once and each name keep its own quirks and speed.
+     *       A name added again with other content, quirks or speed
+     *       is rejected.
+     * @param rom_name : Target ROM name.
+     * @param rom_data : Target ROM bytes.
+     * @param rom_size : Target ROM size in bytes.
+     * @param quirks : Target ROM quirks flags.
+     * @param instruction_per_second : Target ROM speed, 0 for default.
+     * @return True when the ROM fit memory and was added.
+     **/
+    bool add(
+        chip8_string rom_name,
+        const uint8_t* rom_data,
+        const size_t rom_size,
+        const uint8_t quirks,
+        const uint32_t instruction_per_second
+    );
+
+    /**
+     * add function
+     * @note Add ROM file to the bundle.
+     * @param rom_path : Target ROM file path.
+     * @param quirks : Target ROM quirks flags.
+     * @param instruction_per_second : Target ROM speed, 0 for default.
+     * @return True when the ROM fit memory and was added.
+     **/
+    bool add(
+        chip8_string rom_path,
+        const uint8_t quirks,
+        const uint32_t instruction_per_second
+    );
+
+    /**
+     * write function
+     * @note Write the bundle file.
+     * @param bundle_path : Target bundle file path.
+     * @return True when the bundle was written.
+     **/
+    bool write( chip8_string bundle_path ) const;
+
+public:
+    /**
+     * validate function
+     * @note Check that a mapped bundle is well formed, every
+     *       record and name must fit inside the file, records must
+     *       be sorted by hash and the name index by name.
+     * @param data : Target bundle bytes.
+     * @param size : Target bundle size in bytes.
+     * @return Pointer to bundle header or nullptr when invalid.
+     **/
+    static const chip8_bundle_header* validate(
+        const uint8_t* data,
+        const size_t size
+    );
+
+public:
+    /**
+     * get_count function
+     * @note Get count of ROM added to the bundle.
+     * @return ROM count.
+     **/
+    uint32_t get_count( ) const;
+
+};
@@ -0,0 +1,274 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_rom_library::chip8_rom_library( )
+    : bundle{ },
+    header{ nullptr },
+    contents{ },
+    names{ },
+    entries{ },
+    name_index{ },
+    rejected{ 0 }
+{ }
+
+bool chip8_rom_library::open( chip8_string library_path ) {
+    close( );
+
+    auto error           = std::error_code{ };
+    auto content_entries = std::unordered_multimap<uint64_t, uint32_t>{ };
+
+    if ( std::filesystem::is_directory( library_path, error ) ) {
+        auto rom_paths     = std::vector<std::filesystem::path>{ };
+        auto contents_size = size_t( 0 );
+
+        for ( const auto& item : std::filesystem::directory_iterator( library_path, error ) ) {
+            if ( !item.is_regular_file( error ) )
+                continue;
+
+            rom_paths.emplace_back( item.path( ) );
+
+            contents_size += std::min( size_t( item.file_size( error ) ), size_t( chip8_rom_manager_unit::Capacity ) );
+        }
+
+        std::sort( rom_paths.begin( ), rom_paths.end( ) );
+
+        // One allocation for every ROM, a mapping per file would exhaust
+        // the process map count on large corpora.
+        contents.reserve( contents_size );
+        names.reserve( rom_paths.size( ) );
+        entries.reserve( rom_paths.size( ) );
+        content_entries.reserve( rom_paths.size( ) );
+
+        for ( const auto& rom_path : rom_paths )
+            read_rom( rom_path, rom_path.filename( ).string( ), content_entries );
+    } else if ( std::filesystem::is_regular_file( library_path, error ) ) {
+        const auto rom_path = std::filesystem::path( library_path );
+
+        if ( bundle.open( library_path ) )
+            header = chip8_rom_bundle::validate( bundle.get_data( ), bundle.get_size( ) );
+
+        if ( header )
+            return exist( );
+
+        bundle.close( );
+
+        read_rom( rom_path, rom_path.filename( ).string( ), content_entries );
+    }
+
+    build_index( );
+
+    return exist( );
+}
+
+void chip8_rom_library::close( ) {
+    header = nullptr;
+
+    bundle.close( );
+    contents.clear( );
+    names.clear( );
+    entries.clear( );
+    name_index.clear( );
+
+    rejected = 0;
+}
+
+void chip8_rom_library::dump( ) const {
+    printf( "> ROM Library : %u ROM, %u rejected\n", get_count( ), rejected );
+
+    for ( auto entry_id = uint32_t( 0 ); entry_id < get_count( ); entry_id++ ) {
+        const auto entry = get( entry_id );
+
+        printf( "[ %016" PRIX64 " ] %4u %s\n", entry.hash, entry.size, entry.name );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_rom_library::read_rom(
+    const std::filesystem::path& rom_path,
+    std::string&& rom_name,
+    std::unordered_multimap<uint64_t, uint32_t>& content_entries
+) {
+    auto error          = std::error_code{ };
+    const auto rom_size = std::filesystem::file_size( rom_path, error );
+
+    if ( error || rom_size == 0 || rom_size > chip8_rom_manager_unit::Capacity ) {
+        rejected += 1;
+
+        return;
+    }
+
+    const auto offset = uint32_t( contents.size( ) );
+    auto rom_file     = std::ifstream( rom_path, std::ios::binary );
+
+    contents.resize( offset + rom_size );
+
+    if ( !rom_file.read( (char*)contents.data( ) + offset, std::streamsize( rom_size ) ) ) {
+        contents.resize( offset );
+
+        rejected += 1;
+
+        return;
+    }
+
+    const auto* rom_data = contents.data( ) + offset;
+    const auto rom_hash  = chip8_hash( rom_data, rom_size );
+    auto rom_offset      = offset;
+
+    // Hash only select candidates, bytes decide the alias.
+    const auto [ first, last ] = content_entries.equal_range( rom_hash );
+
+    for ( auto content = first; content != last; content++ ) {
+        const auto& entry = entries[ content->second ];
+
+        if ( entry.size == rom_size && std::memcmp( contents.data( ) + entry.offset, rom_data, rom_size ) == 0 ) {
+            rom_offset = entry.offset;
+
+            break;
+        }
+    }
+
+    if ( rom_offset != offset )
+        contents.resize( offset );
+    else
+        content_entries.emplace( rom_hash, uint32_t( entries.size( ) ) );
+
+    entries.push_back( { rom_hash, nullptr, nullptr, rom_offset, 0, uint16_t( rom_size ), ecq_none } );
+    names.emplace_back( std::move( rom_name ) );
+}
+
+void chip8_rom_library::build_index( ) {
+    // Buffers are complete, pointers can't move anymore.
+    for ( auto entry_id = size_t( 0 ); entry_id < entries.size( ); entry_id++ ) {
+        entries[ entry_id ].name = names[ entry_id ].c_str( );
+        entries[ entry_id ].data = contents.data( ) + entries[ entry_id ].offset;
+    }
+
+    auto by_hash = []( const chip8_rom_entry& left, const chip8_rom_entry& right ) -> bool {
+        return left.hash < right.hash;
+    };
+
+    std::stable_sort( entries.begin( ), entries.end( ), by_hash );
+
+    name_index.resize( entries.size( ) );
+
+    for ( auto entry_id = uint32_t( 0 ); entry_id < name_index.size( ); entry_id++ )
+        name_index[ entry_id ] = entry_id;
+
+    auto by_name = [ this ]( const uint32_t left, const uint32_t right ) -> bool {
+        return std::strcmp( entries[ left ].name, entries[ right ].name ) < 0;
+    };
+
+    std::sort( name_index.begin( ), name_index.end( ), by_name );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_rom_entry chip8_rom_library::get_record( const uint32_t record_id ) const {
+    const auto* bundle_data = bundle.get_data( );
+    const auto* records     = (const chip8_bundle_record*)( bundle_data + header->records_offset );
+    const auto& record      = records[ record_id ];
+
+    return {
+        record.hash,
+        (chip8_string)( bundle_data + header->names_offset + record.name_offset ),
+        bundle_data + header->data_offset + record.data_offset,
+        header->data_offset + record.data_offset,
+        record.instruction_per_second,
+        record.size,
+        record.quirks
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_rom_library::exist( ) const {
+    return get_count( ) > 0;
+}
+
+bool chip8_rom_library::is_bundle( ) const {
+    return header != nullptr;
+}
+
+std::tuple<bool, chip8_rom_entry> chip8_rom_library::find( const uint64_t rom_hash ) const {
+    if ( header ) {
+        const auto* records = (const chip8_bundle_record*)( bundle.get_data( ) + header->records_offset );
+        const auto* record  = std::lower_bound( 
+            records, records + header->rom_count, rom_hash,
+            []( const chip8_bundle_record& record, const uint64_t hash ) -> bool {
+                return record.hash < hash;
+            }
+        );
+
+        if ( record != records + header->rom_count && record->hash == rom_hash )
+            return { true, get_record( uint32_t( record - records ) ) };
+
+        return { false, { } };
+    }
+
+    auto by_hash = []( const chip8_rom_entry& entry, const uint64_t hash ) -> bool {
+        return entry.hash < hash;
+    };
+
+    const auto entry = std::lower_bound( entries.begin( ), entries.end( ), rom_hash, by_hash );
+
+    if ( entry != entries.end( ) && entry->hash == rom_hash )
+        return { true, *entry };
+
+    return { false, { } };
+}
+
+std::tuple<bool, chip8_rom_entry> chip8_rom_library::find( chip8_string rom_name ) const {
+    if ( header ) {
+        const auto* name_index = (const uint32_t*)( bundle.get_data( ) + header->name_index_offset );
+        const auto* record_id  = std::lower_bound( 
+            name_index, name_index + header->rom_count, rom_name,
+            [ this ]( const uint32_t record_id, chip8_string name ) -> bool {
+                return std::strcmp( get_record( record_id ).name, name ) < 0;
+            }
+        );
+
+        if ( record_id != name_index + header->rom_count ) {
+            const auto entry = get_record( *record_id );
+
+            if ( std::strcmp( entry.name, rom_name ) == 0 )
+                return { true, entry };
+        }
+
+        return { false, { } };
+    }
+
+    auto by_name = [ this ]( const uint32_t entry_id, chip8_string name ) -> bool {
+        return std::strcmp( entries[ entry_id ].name, name ) < 0;
+    };
+
+    const auto entry_id = std::lower_bound( name_index.begin( ), name_index.end( ), rom_name, by_name );
+
+    if ( entry_id != name_index.end( ) && std::strcmp( entries[ *entry_id ].name, rom_name ) == 0 )
+        return { true, entries[ *entry_id ] };
+
+    return { false, { } };
+}
+
+chip8_rom_entry chip8_rom_library::get( const uint32_t rom_id ) const {
+    if ( header )
+        return get_record( rom_id );
+
+    return entries[ rom_id ];
+}
+
+uint32_t chip8_rom_library::get_count( ) const {
+    if ( header )
+        return header->rom_count;
+
+    return uint32_t( entries.size( ) );
+}
+
+uint32_t chip8_rom_library::get_rejected( ) const {
+    return rejected;
+}
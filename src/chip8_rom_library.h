@@ -0,0 +1,158 @@
+#pragma once
+
+#include "chip8_rom_bundle.h"
+
+/**
+ * Define a ROM library record.
+ * @field hash : ROM content hash, library key.
+ * @field name : ROM name, file name for directory library.
+ * @field data : Pointer to ROM bytes.
+ * @field offset : ROM bytes offset inside the bundle mapping or
+ *                 the directory content buffer.
+ * @field instruction_per_second : ROM speed, 0 for default.
+ * @field size : ROM size in bytes.
+ * @field quirks : ROM quirks flags from echip8_rom_quirks.
+ **/
+struct chip8_rom_entry {
+    uint64_t hash;
+    chip8_string name;
+    const uint8_t* data;
+    uint32_t offset;
+    uint32_t instruction_per_second;
+    uint16_t size;
+    uint8_t quirks;
+};
+
+/**
+ * chip8_rom_library class
+ * @note Read a ROM directory into one contiguous buffer or map a
+ *       ROM bundle once and index each ROM by content hash, loading
+ *       a ROM is then a single bounded copy without any filesystem
+ *       access. Bundle index is used in place from the mapping.
+ **/
+class chip8_rom_library final {
+
+private:
+    chip8_mapped_file bundle;
+    const chip8_bundle_header* header;
+    std::vector<uint8_t> contents;
+    std::vector<std::string> names;
+    std::vector<chip8_rom_entry> entries;
+    std::vector<uint32_t> name_index;
+    uint32_t rejected;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_rom_library( );
+
+    /**
+     * open function
+     * @note Read a ROM directory or a single ROM file, or map a ROM
+     *       bundle, and build the hash index. ROM that can't fit the
+     *       memory are rejected once here.
+     * @param library_path : Target directory, bundle or file path.
+     * @return True when at least one ROM is indexed.
+     **/
+    bool open( chip8_string library_path );
+
+    /**
+     * close method
+     * @note Release all ROM and clear the index.
+     **/
+    void close( );
+
+    /**
+     * dump method
+     * @note Dump library index content.
+     **/
+    void dump( ) const;
+
+private:
+    /**
+     * read_rom method
+     * @note Append a ROM file to the content buffer and add it to
+     *       the index, a ROM with the same bytes as an already read
+     *       one share its content.
+     * @param rom_path : Target ROM file path.
+     * @param rom_name : Target ROM name.
+     * @param content_entries : First entry of each content by hash.
+     **/
+    void read_rom(
+        const std::filesystem::path& rom_path,
+        std::string&& rom_name,
+        std::unordered_multimap<uint64_t, uint32_t>& content_entries
+    );
+
+    /**
+     * build_index method
+     * @note Resolve entry names and bytes, sort entries by hash and
+     *       build the name index, every name is kept even when
+     *       content is duplicated.
+     **/
+    void build_index( );
+
+private:
+    /**
+     * get_record function
+     * @note Convert a bundle record to ROM entry.
+     * @param record_id : Target bundle record index.
+     * @return ROM entry.
+     **/
+    chip8_rom_entry get_record( const uint32_t record_id ) const;
+
+public:
+    /**
+     * exist function
+     * @note Get if the library contains ROM.
+     * @return True when at least one ROM is indexed.
+     **/
+    bool exist( ) const;
+
+    /**
+     * is_bundle function
+     * @note Get if the library is a mapped ROM bundle.
+     * @return True for bundle library.
+     **/
+    bool is_bundle( ) const;
+
+    /**
+     * find function
+     * @note Find a ROM by content hash.
+     * @param rom_hash : Target ROM hash.
+     * @return Tuple of ROM validity and ROM entry.
+     **/
+    std::tuple<bool, chip8_rom_entry> find( const uint64_t rom_hash ) const;
+
+    /**
+     * find function
+     * @note Find a ROM by name.
+     * @param rom_name : Target ROM name.
+     * @return Tuple of ROM validity and ROM entry.
+     **/
+    std::tuple<bool, chip8_rom_entry> find( chip8_string rom_name ) const;
+
+    /**
+     * get function
+     * @note Get ROM entry by index, entries are sorted by hash.
+     * @param rom_id : Target ROM index.
+     * @return ROM entry.
+     **/
+    chip8_rom_entry get( const uint32_t rom_id ) const;
+
+    /**
+     * get_count function
+     * @note Get indexed ROM count.
+     * @return Indexed ROM count.
+     **/
+    uint32_t get_count( ) const;
+
+    /**
+     * get_rejected function
+     * @note Get ROM count rejected at open for invalid size.
+     * @return Rejected ROM count.
+     **/
+    uint32_t get_rejected( ) const;
+
+};
@@ -4,7 +4,8 @@
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 chip8_screen_manager_unit::chip8_screen_manager_unit( )
-    : screen_buffer{ }
+    : screen_buffer{ },
+    draw_count{ 0 }
 { }
 
 void chip8_screen_manager_unit::set_clear_callback(
@@ -41,7 +42,7 @@ void chip8_screen_manager_unit::display(
 
     for ( auto sprite_row = 0; sprite_row < payload.n; sprite_row++ ) {
         const auto position_y = uint8_t( screen_y + sprite_row );
-        const auto sprite     = mmu.read( cpu.I + sprite_row );
+        const auto sprite     = mmu.read( cpu.state.I + sprite_row );
 
         if ( position_y >= rows )
             return;
@@ -49,9 +50,19 @@ void chip8_screen_manager_unit::display(
         draw_sprite( mmu, { sprite, screen_x, position_y } );
     }
 
+    auto draw_scope = chip8_event_scope{ "draw", "callback", cpu.state.cycles };
+
     invoke_user_draw( );
 }
 
+void chip8_screen_manager_unit::save_state( chip8_machine_state& state ) const {
+    std::memcpy( state.screen.data( ), screen_buffer.get( ), state.screen.size( ) );
+}
+
+void chip8_screen_manager_unit::load_state( const chip8_machine_state& state ) {
+    screen_buffer.set( state.screen.data( ) );
+}
+
 void chip8_screen_manager_unit::dump( ) {
     auto line = std::array<char, columns+1>{ };
 
@@ -103,6 +114,8 @@ void chip8_screen_manager_unit::draw_sprite(
 }
 
 void chip8_screen_manager_unit::invoke_user_draw( ) {
+    draw_count += 1;
+
     if ( !user_draw ) 
         return;
 
@@ -120,6 +133,10 @@ const uint8_t* chip8_screen_manager_unit::get_screen_buffer( ) const {
     return screen_buffer.get( );
 }
 
+uint64_t chip8_screen_manager_unit::get_draw_count( ) const {
+    return draw_count;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PRIVATE GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,7 @@ struct chip8_screen_payload {
  **/
 class chip8_screen_manager_unit final {
 
+public:
     static constexpr uint16_t columns  = 64;
     static constexpr uint16_t rows     = 32;
     static constexpr uint16_t dimenion = ( columns * rows );
@@ -28,6 +29,7 @@ private:
     chip8_bitset<dimenion> screen_buffer;
     chip8_display_clear_callback user_clear;
     chip8_display_draw_callback user_draw;
+    uint64_t draw_count;
 
 public:
     /**
@@ -72,6 +74,21 @@ public:
         const chip8_screen_payload& payload
     );
 
+    /**
+     * save_state method
+     * @note Copy screen buffer to a machine state.
+     * @param state : Target machine state.
+     **/
+    void save_state( chip8_machine_state& state ) const;
+
+    /**
+     * load_state method
+     * @note Copy screen buffer from a machine state, user 
+     *       callbacks are not invoked.
+     * @param state : Source machine state.
+     **/
+    void load_state( const chip8_machine_state& state );
+
     /**
      * dump method
      * @note Dump the screen buffer content.
@@ -118,6 +135,13 @@ public:
      **/
     const uint8_t* get_screen_buffer( ) const;
 
+    /**
+     * get_draw_count function
+     * @note Get display count since construction.
+     * @return Display count.
+     **/
+    uint64_t get_draw_count( ) const;
+
 private:
     /**
      * get_pixel_id function
@@ -3,34 +3,48 @@
 ////////////////////////////////////////////////////////////////////////////////////////////
 //		===	PUBLIC ===
 ////////////////////////////////////////////////////////////////////////////////////////////
-chip8_stack_mananger::chip8_stack_mananger( )
-    : stack{ }
+chip8_stack_mananger::chip8_stack_mananger( chip8_hot_state& hot_state )
+    : state{ hot_state },
+    stack{ }
 { }
 
 bool chip8_stack_mananger::push(
     const uint16_t address,
     const bool is_unlimited
 ) {
-    if ( !is_unlimited && stack.size( ) == StackSize )
+    const auto stack_limit = is_unlimited ? Capacity : StackSize;
+
+    if ( state.SP >= stack_limit )
         return false;
 
-    stack.push( address );
+    stack[ state.SP++ ] = address;
 
     return true;
 }
 
+void chip8_stack_mananger::reset( ) {
+    state.SP = 0;
+}
+
+void chip8_stack_mananger::save_state( chip8_machine_state& machine_state ) const {
+    machine_state.stack = stack;
+}
+
+void chip8_stack_mananger::load_state( const chip8_machine_state& machine_state ) {
+    stack = machine_state.stack;
+
+    state.SP = std::min( state.SP, uint8_t( Capacity ) );
+}
+
 void chip8_stack_mananger::dump( ) const {
-    auto local_stack = stack;
-    auto stack_id    = local_stack.size( );
+    auto stack_id = state.SP;
 
     printf( "> Stack %d :\n", stack_id );
 
     while ( stack_id-- > 0 ) {
-        printf( "[ %2d ] 0x%4X\n", stack_id, local_stack.top( ) );
-            
-        local_stack.pop( );
+        printf( "[ %2d ] 0x%4X\n", stack_id, stack[ stack_id ] );
 
-        if ( stack_id == 17 )
+        if ( stack_id == StackSize )
             printf( ">> Default chip 8 16 slot stack :\n" );
     }
 }
@@ -39,13 +53,16 @@ void chip8_stack_mananger::dump( ) const {
 //		===	PUBLIC GET ===
 ////////////////////////////////////////////////////////////////////////////////////////////
 std::tuple<uint16_t, bool> chip8_stack_mananger::pop( ) {
-    auto address = eca_null;
+    if ( state.SP == 0 )
+        return std::make_tuple( uint16_t( eca_null ), false );
+
+    return std::make_tuple( stack[ --state.SP ], true );
+}
 
-    if ( stack.size( ) > 0 ) {
-        const auto address = stack.top( );
+uint8_t chip8_stack_mananger::get_depth( ) const {
+    return std::min( state.SP, uint8_t( Capacity ) );
+}
 
-        stack.pop( );
-    }
-        
-    return std::make_tuple( address, true );
+uint16_t chip8_stack_mananger::get( const uint8_t stack_id ) const {
+    return stack[ stack_id ];
 }
@@ -1,29 +1,37 @@
 #pragma once
 
-#include "chip8_globals.h"
+#include "chip8_hot_state.h"
+
+struct chip8_machine_state;
 
 /**
  * chip8_stack_mananger class
- * @note Store and manage call stack.
+ * @note Store and manage call stack, stored in place so a
+ *       machine never allocate.
  **/
 class chip8_stack_mananger final {
 
+public:
     static constexpr uint16_t StackSize = 16;
+    static constexpr uint16_t Capacity  = 64;
 
 private:
-    std::stack<uint16_t> stack;
+    chip8_hot_state& state;
+    std::array<uint16_t, Capacity> stack;
 
 public:
     /**
      * Constructor
+     * @param hot_state : Reference to machine hot state, own SP.
      **/
-    chip8_stack_mananger( );
+    chip8_stack_mananger( chip8_hot_state& hot_state );
 
     /**
      * push function
      * @note Push address on top of the call stack.
      * @param address : Target address to push.
-     * @param is_unlimited : True when the stack can grow infinitly.
+     * @param is_unlimited : True when the stack can grow up to 
+     *                       Capacity instead of StackSize.
      * @return True when address is adde, false when stack 
      *         is already full.
      **/
@@ -32,6 +40,26 @@ public:
         const bool is_unlimited
     );
 
+    /**
+     * reset method
+     * @note Empty the call stack.
+     **/
+    void reset( );
+
+    /**
+     * save_state method
+     * @note Copy call stack to a machine state.
+     * @param machine_state : Target machine state.
+     **/
+    void save_state( chip8_machine_state& machine_state ) const;
+
+    /**
+     * load_state method
+     * @note Copy call stack from a machine state.
+     * @param machine_state : Source machine state.
+     **/
+    void load_state( const chip8_machine_state& machine_state );
+
     /**
      * dump method
      * @note Dump stack content.
@@ -47,4 +75,19 @@ public:
      **/
     std::tuple<uint16_t, bool> pop( );
 
+    /**
+     * get_depth function
+     * @note Get call stack depth.
+     * @return Count of pushed addresses.
+     **/
+    uint8_t get_depth( ) const;
+
+    /**
+     * get function
+     * @note Get a pushed return address, 0 is the outermost call.
+     * @param stack_id : Target stack slot, below get_depth.
+     * @return Return address.
+     **/
+    uint16_t get( const uint8_t stack_id ) const;
+
 };
@@ -2,49 +2,54 @@
 
 /**
  * echip8_timer_manager class
- * @note Manage thread for timer 60Hz management.
+ * @note Register cpu timers to the shared 60Hz timer service
+ *       for the duration of an execution.
  **/
 class echip8_timer_manager final {
 
-    using clock_t = std::chrono::steady_clock;
-
 private:
-    std::atomic<bool> is_running;
-    std::thread thread;
+    uint32_t slot;
 
 public:
     /**
      * Constructor
      * @param cpu : Reference to current cpu manager unit.
+     * @param enabled : False when timers are updated by the
+     *                  interpreter, timers aren't registered.
      **/
-    echip8_timer_manager( chip8_cpu_manager_unit& cpu ) 
-        : is_running{ true }
+    echip8_timer_manager( chip8_cpu_manager_unit& cpu, const bool enabled ) 
+        : slot{ chip8_timer_service::Invalid }
     {
-        auto exec_lambda = [&]() -> void {
-            constexpr auto duration = std::chrono::milliseconds( 16 );
-            auto next_tick = clock_t::now( ) + duration;
-
-            while ( is_running ) {
-                std::this_thread::sleep_until( next_tick );
-
-                next_tick = std::max( next_tick + duration, clock_t::now( ) );
+        if ( enabled )
+            slot = chip8_timer_service::get( ).attach( cpu.timers );
+    };
 
-                cpu.update_timers( );
-            }
-        };
+    /**
+     * Destructor
+     **/
+    ~echip8_timer_manager( ) {
+        terminate( );
+    };
 
-        thread = std::move( std::thread( exec_lambda ) );
+    /**
+     * get_is_attached function
+     * @note Get if timers are updated by the timer service, false
+     *       when disabled or when the service is full.
+     * @return True when timers are registered.
+     **/
+    bool get_is_attached( ) const {
+        return slot != chip8_timer_service::Invalid;
     };
 
     /**
      * terminate method
-     * @note Terminate the timer thread.
+     * @note Unregister timers from the timer service.
      **/
     void terminate( ) {
-        if ( thread.joinable( ) ) {
-            is_running = false;
+        if ( slot != chip8_timer_service::Invalid ) {
+            chip8_timer_service::get( ).detach( slot );
 
-            thread.join( );
+            slot = chip8_timer_service::Invalid;
         }
     };
 
@@ -0,0 +1,162 @@
+#include "chip8.h"
+
+#ifndef WINDOWS
+#   include <cerrno>
+#   include <time.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_timer_service::chip8_timer_service( )
+    : slots{ },
+    slot_count{ 0 },
+    registered{ 0 },
+    passes{ 0 },
+    is_running{ true },
+    thread{ }
+{
+    thread = std::thread( [ this ]( ) -> void { run( ); } );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_timer_service::~chip8_timer_service( ) {
+    is_running = false;
+
+    // Change the parking value so the service thread wakes up.
+    registered.fetch_add( 1 );
+    registered.notify_all( );
+
+    if ( thread.joinable( ) )
+        thread.join( );
+}
+
+uint32_t chip8_timer_service::attach( chip8_cpu_timer_manager& timers ) {
+    for ( auto slot = uint32_t( 0 ); slot < Capacity; slot++ ) {
+        auto* empty = (chip8_cpu_timer_manager*)nullptr;
+
+        if ( !slots[ slot ].compare_exchange_strong( empty, &timers ) )
+            continue;
+
+        auto count = slot_count.load( );
+
+        while ( count <= slot && !slot_count.compare_exchange_weak( count, slot + 1 ) );
+
+        if ( registered.fetch_add( 1 ) == 0 )
+            registered.notify_one( );
+
+        return slot;
+    }
+
+    return Invalid;
+}
+
+void chip8_timer_service::detach( const uint32_t slot ) {
+    if ( Capacity <= slot )
+        return;
+
+    slots[ slot ].store( nullptr );
+    registered.fetch_sub( 1 );
+
+    // Odd pass count means a pass is running and may hold the timers.
+    const auto pass = passes.load( );
+
+    if ( pass & 1 ) {
+        while ( passes.load( ) == pass )
+            std::this_thread::yield( );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+void chip8_timer_service::run( ) {
+#ifdef WINDOWS
+    using clock_t = std::chrono::steady_clock;
+
+    const auto period = std::chrono::nanoseconds( Period );
+    auto deadline     = clock_t::now( );
+#else
+    auto deadline = timespec{ };
+
+    clock_gettime( CLOCK_MONOTONIC, &deadline );
+#endif
+
+    while ( is_running ) {
+        auto count = registered.load( );
+
+        if ( count == 0 ) {
+            registered.wait( count );
+
+#ifdef WINDOWS
+            deadline = clock_t::now( );
+#else
+            clock_gettime( CLOCK_MONOTONIC, &deadline );
+#endif
+            continue;
+        }
+
+#ifdef WINDOWS
+        deadline = std::max( deadline + period, clock_t::now( ) );
+
+        std::this_thread::sleep_until( deadline );
+#else
+        auto now = timespec{ };
+
+        clock_gettime( CLOCK_MONOTONIC, &now );
+
+        deadline.tv_nsec += Period;
+
+        if ( deadline.tv_nsec >= 1000000000 ) {
+            deadline.tv_nsec -= 1000000000;
+            deadline.tv_sec  += 1;
+        }
+
+        // Late by more than a period, resync instead of bursting.
+        if ( deadline.tv_sec < now.tv_sec || ( deadline.tv_sec == now.tv_sec && deadline.tv_nsec < now.tv_nsec ) )
+            deadline = now;
+
+        while ( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr ) == EINTR );
+#endif
+
+        update( );
+    }
+}
+
+void chip8_timer_service::update( ) {
+    passes.fetch_add( 1 );
+
+    const auto count = slot_count.load( );
+
+    for ( auto slot = uint32_t( 0 ); slot < count; slot++ ) {
+        auto* timers = slots[ slot ].load( );
+
+        // Cycles belong to the emulation thread, ticks here carry none.
+        if ( timers )
+            timers->update( 0 );
+    }
+
+    passes.fetch_add( 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t chip8_timer_service::get_count( ) const {
+    return registered.load( );
+}
+
+uint64_t chip8_timer_service::get_passes( ) const {
+    return passes.load( ) / 2;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_timer_service& chip8_timer_service::get( ) {
+    static auto service = chip8_timer_service{ };
+
+    return service;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "chip8_cmu.h"
+
+/**
+ * chip8_timer_service class
+ * @note Process wide 60Hz timer service, a single thread updates
+ *       the timers of every registered machine in one pass. Timers
+ *       are registered in a fixed slot array, registration and
+ *       unregistration never take a lock.
+ **/
+class chip8_timer_service final {
+
+public:
+    static constexpr uint32_t Capacity = 4096;
+    static constexpr uint32_t Invalid  = 0xFFFFFFFF;
+    static constexpr int64_t Period    = 1000000000 / 60;
+
+private:
+    std::array<std::atomic<chip8_cpu_timer_manager*>, Capacity> slots;
+    std::atomic<uint32_t> slot_count;
+    std::atomic<uint32_t> registered;
+    std::atomic<uint64_t> passes;
+    std::atomic<bool> is_running;
+    std::thread thread;
+
+private:
+    /**
+     * Constructor
+     * @note Service is only reachable through get.
+     **/
+    chip8_timer_service( );
+
+public:
+    /**
+     * Copy-Constructor
+     * @note Service is unique to the process.
+     **/
+    chip8_timer_service( const chip8_timer_service& ) = delete;
+
+    /**
+     * Destructor
+     **/
+    ~chip8_timer_service( );
+
+    /**
+     * attach function
+     * @note Register timers to the service, service thread is
+     *       started on first registration.
+     * @param timers : Target timers to update at 60Hz.
+     * @return Slot index, Invalid when the service is full and the
+     *         caller must update its timers itself.
+     **/
+    uint32_t attach( chip8_cpu_timer_manager& timers );
+
+    /**
+     * detach method
+     * @note Unregister timers from the service, when the service
+     *       is in the middle of a pass the call wait for its end so
+     *       timers are never touched after return.
+     * @param slot : Slot index returned by attach.
+     **/
+    void detach( const uint32_t slot );
+
+private:
+    /**
+     * run method
+     * @note Service thread loop, sleep to absolute 60Hz deadlines
+     *       and park while no timers are registered.
+     **/
+    void run( );
+
+    /**
+     * update method
+     * @note Update all registered timers once.
+     **/
+    void update( );
+
+public:
+    /**
+     * get_count function
+     * @note Get registered timers count.
+     * @return Registered timers count.
+     **/
+    uint32_t get_count( ) const;
+
+    /**
+     * get_passes function
+     * @note Get update pass count since service start.
+     * @return Update pass count.
+     **/
+    uint64_t get_passes( ) const;
+
+public:
+    /**
+     * get function
+     * @note Get process timer service.
+     * @return Reference to timer service.
+     **/
+    static chip8_timer_service& get( );
+
+public:
+    /**
+     * operator=
+     * @note Service is unique to the process.
+     **/
+    chip8_timer_service& operator=( const chip8_timer_service& ) = delete;
+
+};
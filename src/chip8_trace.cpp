@@ -0,0 +1,218 @@
+#include "chip8.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+chip8_trace_recorder::chip8_trace_recorder( )
+    : head{ 0 },
+    tail{ 0 },
+    is_running{ false },
+    head_cache{ 0 },
+    pending_gap{ 0 },
+    dropped{ 0 },
+    written{ 0 },
+    trace_file{ nullptr },
+    drain_thread{ },
+    records{ }
+{ }
+
+chip8_trace_recorder::~chip8_trace_recorder( ) {
+    stop( );
+}
+
+bool chip8_trace_recorder::start( chip8_string trace_path ) {
+    stop( );
+
+    trace_file = fopen( trace_path, "wb" );
+
+    if ( !trace_file )
+        return false;
+
+    const auto header = chip8_trace_header{ Magic, Version, uint16_t( sizeof( chip8_trace_record ) ) };
+
+    fwrite( &header, sizeof( header ), 1, trace_file );
+
+    records.resize( Capacity );
+
+    head.store( 0 );
+    tail.store( 0 );
+
+    head_cache  = 0;
+    pending_gap = 0;
+    dropped     = 0;
+    written     = 0;
+
+    is_running   = true;
+    drain_thread = std::thread( [ this ]( ) -> void { drain_loop( ); } );
+
+    return true;
+}
+
+void chip8_trace_recorder::stop( ) {
+    if ( !trace_file )
+        return;
+
+    is_running = false;
+
+    if ( drain_thread.joinable( ) )
+        drain_thread.join( );
+
+    while ( drain( 1 ) > 0 );
+
+    // Records dropped after the last pushed one.
+    if ( pending_gap > 0 ) {
+        const auto gap = chip8_trace_record{ pending_gap, 0, 0, 0, Gap, 0 };
+
+        written    += fwrite( &gap, sizeof( gap ), 1, trace_file );
+        pending_gap = 0;
+    }
+
+    fclose( trace_file );
+
+    trace_file = nullptr;
+}
+
+void chip8_trace_recorder::record( const chip8_trace_record& record ) {
+    const auto tail_id = tail.load( std::memory_order_relaxed );
+    const auto needed  = pending_gap > 0 ? uint32_t( 2 ) : uint32_t( 1 );
+
+    // Head is only reloaded when the cached one show a full ring.
+    if ( Capacity - ( tail_id - head_cache ) < needed ) {
+        head_cache = head.load( std::memory_order_acquire );
+
+        if ( Capacity - ( tail_id - head_cache ) < needed ) {
+            dropped     += 1;
+            pending_gap += 1;
+
+            return;
+        }
+    }
+
+    auto next_id = tail_id;
+
+    if ( pending_gap > 0 ) {
+        records[ next_id++ & Mask ] = chip8_trace_record{ pending_gap, 0, 0, 0, Gap, 0 };
+        pending_gap = 0;
+    }
+
+    records[ next_id++ & Mask ] = record;
+
+    tail.store( next_id, std::memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PRIVATE ===
+////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t chip8_trace_recorder::drain( const uint32_t minimum ) {
+    const auto head_id = head.load( std::memory_order_relaxed );
+    const auto tail_id = tail.load( std::memory_order_acquire );
+
+    if ( head_id == tail_id || tail_id - head_id < minimum )
+        return 0;
+
+    // Write up to the ring end, the wrapped part goes next call.
+    const auto first = head_id & Mask;
+    const auto count = std::min( tail_id - head_id, Capacity - first );
+
+    fwrite( records.data( ) + first, sizeof( chip8_trace_record ), count, trace_file );
+
+    head.store( head_id + count, std::memory_order_release );
+
+    written += count;
+
+    return count;
+}
+
+void chip8_trace_recorder::drain_loop( ) {
+    // Only full batches are written while running, the ring hold tens
+    // of milliseconds of unthrottled execution so a short sleep never
+    // fill it.
+    while ( is_running.load( std::memory_order_relaxed ) ) {
+        if ( drain( Batch ) == 0 )
+            std::this_thread::sleep_for( std::chrono::microseconds( 500 ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC GET ===
+////////////////////////////////////////////////////////////////////////////////////////////
+bool chip8_trace_recorder::is_enabled( ) const {
+    return trace_file != nullptr;
+}
+
+uint64_t chip8_trace_recorder::get_dropped( ) const {
+    return dropped;
+}
+
+uint64_t chip8_trace_recorder::get_written( ) const {
+    return written;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+//		===	PUBLIC STATIC ===
+////////////////////////////////////////////////////////////////////////////////////////////
+const chip8_trace_record* chip8_trace_recorder::validate(
+    const uint8_t* data,
+    const size_t size
+) {
+    if ( !data || size < sizeof( chip8_trace_header ) )
+        return nullptr;
+
+    const auto* header = (const chip8_trace_header*)data;
+
+    const auto is_valid =
+        header->magic == Magic &&
+        header->version == Version &&
+        header->record_size == sizeof( chip8_trace_record ) &&
+        ( size - sizeof( chip8_trace_header ) ) % sizeof( chip8_trace_record ) == 0;
+
+    if ( !is_valid )
+        return nullptr;
+
+    return (const chip8_trace_record*)( data + sizeof( chip8_trace_header ) );
+}
+
+echip8_formats chip8_trace_recorder::get_format( const uint8_t opcode ) {
+    switch ( opcode ) {
+        case 0x5 :
+        case 0x8 :
+        case 0x9 :
+        case 0xD : return ecf_xyn;
+
+        case 0x0 :
+        case 0x1 :
+        case 0x2 :
+        case 0xA :
+        case 0xB : return ecf_nnn;
+
+        default : break;
+    }
+
+    return ecf_xnn;
+}
+
+uint8_t chip8_trace_recorder::get_register( const uint16_t instruction ) {
+    const auto register_x = uint8_t( ( instruction & 0x0F00 ) >> 8 );
+
+    switch ( instruction >> 12 ) {
+        case 0x6 :
+        case 0x7 :
+        case 0x8 :
+        case 0xC : return register_x;
+        case 0xD : return 0xF;
+
+        case 0xF :
+            switch ( instruction & 0x00FF ) {
+                case 0x07 :
+                case 0x0A :
+                case 0x65 : return register_x;
+
+                default : break;
+            }
+            break;
+
+        default : break;
+    }
+
+    return Unchanged;
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "chip8_cpu_random_manager.h"
+
+/**
+ * Define binary trace file header.
+ * @field magic : Trace magic value, chip8_trace_recorder::Magic.
+ * @field version : Trace format version.
+ * @field record_size : Size of one trace record.
+ **/
+struct chip8_trace_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+};
+
+/**
+ * Define a binary trace record, one per executed instruction.
+ * @note A record with Gap as register_id marks dropped records,
+ *       its cycle holds the dropped record count.
+ * @field cycle : Executed instruction count.
+ * @field PC : PC after fetch, as printed by the text trace.
+ * @field instruction : Executed instruction.
+ * @field I : Index register after execution.
+ * @field register_id : Register written by the instruction,
+ *                      Unchanged when none.
+ * @field value : Written register value after execution.
+ **/
+struct chip8_trace_record {
+    uint64_t cycle;
+    uint16_t PC;
+    uint16_t instruction;
+    uint16_t I;
+    uint8_t register_id;
+    uint8_t value;
+};
+
+static_assert( sizeof( chip8_trace_record ) == 16 );
+
+/**
+ * chip8_trace_recorder class
+ * @note Record executed instructions as fixed size binary records
+ *       in a lock-free single producer single consumer ring. A
+ *       background thread drain the ring into a file by batches,
+ *       the emulation thread never format, lock or block. Records
+ *       are dropped when the ring is full, and a gap record with
+ *       the dropped count is written in their place.
+ **/
+class chip8_trace_recorder final {
+
+public:
+    static constexpr uint32_t Magic     = 0x52543843;
+    static constexpr uint16_t Version   = 2;
+    static constexpr uint32_t Capacity  = 1 << 20;
+    static constexpr uint32_t Mask      = Capacity - 1;
+    static constexpr uint32_t Batch     = 1 << 14;
+    static constexpr uint8_t Unchanged  = 0xFF;
+    static constexpr uint8_t Gap        = 0xFE;
+
+private:
+    alignas( 64 ) std::atomic<uint32_t> head;
+    alignas( 64 ) std::atomic<uint32_t> tail;
+    alignas( 64 ) std::atomic<bool> is_running;
+    uint32_t head_cache;
+    uint64_t pending_gap;
+    uint64_t dropped;
+    uint64_t written;
+    FILE* trace_file;
+    std::thread drain_thread;
+    std::vector<chip8_trace_record> records;
+
+public:
+    /**
+     * Constructor
+     **/
+    chip8_trace_recorder( );
+
+    /**
+     * Destructor
+     **/
+    ~chip8_trace_recorder( );
+
+    /**
+     * start function
+     * @note Open trace file and start the drain thread.
+     * @param trace_path : Target trace file path.
+     * @return True when the trace file was opened.
+     **/
+    bool start( chip8_string trace_path );
+
+    /**
+     * stop method
+     * @note Stop the drain thread, write pending records and
+     *       close the trace file.
+     **/
+    void stop( );
+
+    /**
+     * record method
+     * @note Push a record, emulation thread only. A gap record is
+     *       pushed first when records were dropped since the last
+     *       one.
+     * @param record : Target record.
+     **/
+    void record( const chip8_trace_record& record );
+
+private:
+    /**
+     * drain function
+     * @note Write pending records to the trace file, up to the ring
+     *       end.
+     * @param minimum : Pending record count required to write.
+     * @return Written record count.
+     **/
+    uint32_t drain( const uint32_t minimum );
+
+    /**
+     * drain_loop method
+     * @note Drain thread body.
+     **/
+    void drain_loop( );
+
+public:
+    /**
+     * is_enabled function
+     * @note Get if a trace is recording.
+     * @return True when recording.
+     **/
+    bool is_enabled( ) const;
+
+    /**
+     * get_dropped function
+     * @note Get record count dropped on full ring, gap records
+     *       hold the same count in the file.
+     * @return Dropped record count.
+     **/
+    uint64_t get_dropped( ) const;
+
+    /**
+     * get_written function
+     * @note Get record count written to the trace file.
+     * @return Written record count.
+     **/
+    uint64_t get_written( ) const;
+
+public:
+    /**
+     * validate function
+     * @note Validate a trace file content.
+     * @param data : Trace file content.
+     * @param size : Trace file size.
+     * @return Pointer to first record, nullptr when invalid.
+     **/
+    static const chip8_trace_record* validate(
+        const uint8_t* data,
+        const size_t size
+    );
+
+    /**
+     * get_format function
+     * @note Get the text trace format used by an opcode.
+     * @param opcode : Target opcode.
+     * @return Instruction text format.
+     **/
+    static echip8_formats get_format( const uint8_t opcode );
+
+    /**
+     * get_register function
+     * @note Get the register written by an instruction, VX for
+     *       FX65 that load V0 to VX.
+     * @param instruction : Target instruction.
+     * @return Register id, Unchanged when none.
+     **/
+    static uint8_t get_register( const uint16_t instruction );
+
+};